@@ -0,0 +1,170 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "lib/distributions/BernoulliDistribution.hpp"
+#include "lib/distributions/BinomialDistribution.hpp"
+#include "lib/distributions/CauchyDistribution.hpp"
+#include "lib/distributions/DistributionExperiment.hpp"
+#include "lib/distributions/ExponentialDistribution.hpp"
+#include "lib/distributions/GeometricDistribution.hpp"
+#include "lib/distributions/LaplaceDistribution.hpp"
+#include "lib/distributions/NormalDistribution.hpp"
+#include "lib/distributions/ParameterSweep.hpp"
+#include "lib/distributions/PoissonDistribution.hpp"
+#include "lib/distributions/UniformDistribution.hpp"
+
+namespace {
+
+using ptm::Distribution;
+
+constexpr size_t kEvaluationPoints = 1024;
+
+// Точки для Pdf/Cdf берутся из самого распределения, чтобы попадать в носитель
+std::vector<double> EvaluationPoints(const Distribution& dist) {
+  std::mt19937 rng(7);
+  std::vector<double> points(kEvaluationPoints);
+  for (double& x : points) {
+    x = dist.Sample(rng);
+  }
+  return points;
+}
+
+void BM_Sample(benchmark::State& state, const std::shared_ptr<Distribution>& dist) {
+  std::mt19937 rng(42);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(dist->Sample(rng));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+void BM_Pdf(benchmark::State& state, const std::shared_ptr<Distribution>& dist) {
+  const std::vector<double> points = EvaluationPoints(*dist);
+  for (auto _ : state) {
+    for (double x : points) {
+      benchmark::DoNotOptimize(dist->Pdf(x));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(points.size()));
+}
+
+void BM_Cdf(benchmark::State& state, const std::shared_ptr<Distribution>& dist) {
+  const std::vector<double> points = EvaluationPoints(*dist);
+  for (auto _ : state) {
+    for (double x : points) {
+      benchmark::DoNotOptimize(dist->Cdf(x));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(points.size()));
+}
+
+void BM_Quantile(benchmark::State& state, const std::shared_ptr<Distribution>& dist) {
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<double> level(0.0, 1.0);
+  std::vector<double> levels(kEvaluationPoints);
+  for (double& u : levels) {
+    u = level(rng);
+  }
+  for (auto _ : state) {
+    for (double u : levels) {
+      benchmark::DoNotOptimize(dist->Quantile(u));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(levels.size()));
+}
+
+// Сетка Poisson(λ) из 16 точек от 1 до 10^5 - общие случайные числа против независимых экспериментов
+std::vector<double> PoissonSweepGrid() {
+  std::vector<double> lambdas(16);
+  for (size_t i = 0; i < lambdas.size(); ++i) {
+    lambdas[i] = std::pow(10.0, 5.0 * static_cast<double>(i) / static_cast<double>(lambdas.size() - 1));
+  }
+  return lambdas;
+}
+
+void BM_ParameterSweep(benchmark::State& state) {
+  const auto sample_size = static_cast<size_t>(state.range(0));
+  const std::vector<double> lambdas = PoissonSweepGrid();
+  const ptm::ParameterSweep sweep = ptm::ParameterSweep::Over(
+      lambdas, [](double lambda) { return std::make_shared<ptm::PoissonDistribution>(lambda); }, sample_size);
+  std::mt19937 rng(42);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(sweep.Run(rng, 1));
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(lambdas.size()) * state.range(0));
+}
+
+void BM_IndependentExperiments(benchmark::State& state) {
+  const auto sample_size = static_cast<size_t>(state.range(0));
+  std::vector<ptm::DistributionExperiment> experiments;
+  for (double lambda : PoissonSweepGrid()) {
+    experiments.emplace_back(std::make_shared<ptm::PoissonDistribution>(lambda), sample_size);
+  }
+  std::mt19937 rng(42);
+  for (auto _ : state) {
+    for (auto& experiment : experiments) {
+      benchmark::DoNotOptimize(experiment.Run(rng));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(experiments.size()) * state.range(0));
+}
+
+void BM_ExperimentRun(benchmark::State& state) {
+  auto dist = std::make_shared<ptm::NormalDistribution>(0.0, 1.0);
+  ptm::DistributionExperiment experiment(dist, static_cast<size_t>(state.range(0)));
+  std::mt19937 rng(42);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(experiment.Run(rng));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_KolmogorovDistance(benchmark::State& state) {
+  auto dist = std::make_shared<ptm::NormalDistribution>(0.0, 1.0);
+  ptm::DistributionExperiment experiment(dist, 0);
+
+  const auto grid_size = static_cast<size_t>(state.range(0));
+  std::vector<double> grid(grid_size);
+  for (size_t i = 0; i < grid_size; ++i) {
+    grid[i] = -4.0 + 8.0 * static_cast<double>(i) / static_cast<double>(grid_size);
+  }
+  std::mt19937 rng(42);
+  const std::vector<double> empirical = experiment.EmpiricalCdf(grid, rng, 100000);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(experiment.KolmogorovDistance(grid, empirical));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+#define PTM_DISTRIBUTION_BENCHMARKS(name, ...)                                                       \
+  BENCHMARK_CAPTURE(BM_Sample, name, std::make_shared<ptm::name##Distribution>(__VA_ARGS__));       \
+  BENCHMARK_CAPTURE(BM_Pdf, name, std::make_shared<ptm::name##Distribution>(__VA_ARGS__));          \
+  BENCHMARK_CAPTURE(BM_Cdf, name, std::make_shared<ptm::name##Distribution>(__VA_ARGS__));          \
+  BENCHMARK_CAPTURE(BM_Quantile, name, std::make_shared<ptm::name##Distribution>(__VA_ARGS__))
+
+PTM_DISTRIBUTION_BENCHMARKS(Normal, 0.0, 1.0);
+PTM_DISTRIBUTION_BENCHMARKS(Uniform, 0.0, 1.0);
+PTM_DISTRIBUTION_BENCHMARKS(Exponential, 1.0);
+PTM_DISTRIBUTION_BENCHMARKS(Cauchy, 0.0, 1.0);
+PTM_DISTRIBUTION_BENCHMARKS(Laplace, 0.0, 1.0);
+PTM_DISTRIBUTION_BENCHMARKS(Bernoulli, 0.3);
+PTM_DISTRIBUTION_BENCHMARKS(Binomial, 1000, 0.3);
+PTM_DISTRIBUTION_BENCHMARKS(Geometric, 0.2);
+PTM_DISTRIBUTION_BENCHMARKS(Poisson, 50.0);
+
+// Стоимость дискретного квантиля растёт с λ, если каждый раз вычислять Cdf
+BENCHMARK_CAPTURE(BM_Sample, PoissonLarge, std::make_shared<ptm::PoissonDistribution>(1e5));
+BENCHMARK_CAPTURE(BM_Quantile, PoissonLarge, std::make_shared<ptm::PoissonDistribution>(1e5));
+BENCHMARK_CAPTURE(BM_Quantile, PoissonSmall, std::make_shared<ptm::PoissonDistribution>(4.0));
+
+BENCHMARK(BM_ParameterSweep)->Arg(1 << 16)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_IndependentExperiments)->Arg(1 << 16)->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_ExperimentRun)->RangeMultiplier(8)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_KolmogorovDistance)->RangeMultiplier(8)->Range(1 << 6, 1 << 15);
@@ -0,0 +1,29 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+
+#include "lib/distributions/BernoulliDistribution.hpp"
+#include "lib/distributions/ExponentialDistribution.hpp"
+#include "lib/law-of-large-numbers/LawOfLargeNumbersSimulator.hpp"
+
+namespace {
+
+void BM_Simulate(benchmark::State& state, const std::shared_ptr<ptm::Distribution>& dist) {
+  ptm::LawOfLargeNumbersSimulator simulator(dist);
+  std::mt19937 rng(42);
+  const auto max_n = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(simulator.Simulate(rng, max_n, 1000));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(BM_Simulate, Bernoulli, std::make_shared<ptm::BernoulliDistribution>(0.3))
+    ->RangeMultiplier(8)
+    ->Range(1 << 12, 1 << 21);
+BENCHMARK_CAPTURE(BM_Simulate, Exponential, std::make_shared<ptm::ExponentialDistribution>(1.0))
+    ->RangeMultiplier(8)
+    ->Range(1 << 12, 1 << 21);
@@ -0,0 +1,119 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "lib/sigma-algebra/Event.hpp"
+#include "lib/sigma-algebra/OutcomeSpace.hpp"
+#include "lib/sigma-algebra/ProbabilityMeasure.hpp"
+
+namespace {
+
+using ptm::Event;
+
+Event RandomEvent(size_t n, std::mt19937& rng) {
+  std::bernoulli_distribution coin(0.5);
+  std::vector<bool> mask(n);
+  for (size_t i = 0; i < n; ++i) {
+    mask[i] = coin(rng);
+  }
+  return Event(mask);
+}
+
+ptm::OutcomeSpace MakeSpace(size_t n) {
+  ptm::OutcomeSpace omega;
+  omega.Reserve(n, n * 8);
+  for (size_t i = 0; i < n; ++i) {
+    omega.AddOutcome(std::to_string(i));
+  }
+  return omega;
+}
+
+void BM_EventUnite(benchmark::State& state) {
+  const auto n = static_cast<size_t>(state.range(0));
+  std::mt19937 rng(42);
+  Event a = RandomEvent(n, rng);
+  const Event b = RandomEvent(n, rng);
+  for (auto _ : state) {
+    a |= b;
+    benchmark::DoNotOptimize(a);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) / 8);
+}
+
+void BM_EventIntersect(benchmark::State& state) {
+  const auto n = static_cast<size_t>(state.range(0));
+  std::mt19937 rng(42);
+  const Event a = RandomEvent(n, rng);
+  const Event b = RandomEvent(n, rng);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Event::Intersect(a, b));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) / 8);
+}
+
+void BM_EventComplement(benchmark::State& state) {
+  const auto n = static_cast<size_t>(state.range(0));
+  std::mt19937 rng(42);
+  const Event a = RandomEvent(n, rng);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(~a);
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) / 8);
+}
+
+void BM_EventSize(benchmark::State& state) {
+  const auto n = static_cast<size_t>(state.range(0));
+  std::mt19937 rng(42);
+  const Event a = RandomEvent(n, rng);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(a.GetSize());
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) / 8);
+}
+
+void BM_Probability(benchmark::State& state) {
+  const auto n = static_cast<size_t>(state.range(0));
+  const ptm::OutcomeSpace omega = MakeSpace(n);
+  ptm::ProbabilityMeasure P(omega);
+  for (size_t i = 0; i < n; ++i) {
+    P.SetAtomicProbability(i, 1.0 / static_cast<double>(n));
+  }
+
+  std::mt19937 rng(42);
+  const Event a = RandomEvent(n, rng);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(P.Probability(a));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ProbabilityBatch(benchmark::State& state) {
+  const auto n = static_cast<size_t>(state.range(0));
+  const auto batch = static_cast<size_t>(state.range(1));
+  const ptm::OutcomeSpace omega = MakeSpace(n);
+  ptm::ProbabilityMeasure P(omega);
+  for (size_t i = 0; i < n; ++i) {
+    P.SetAtomicProbability(i, 1.0 / static_cast<double>(n));
+  }
+
+  std::mt19937 rng(42);
+  std::vector<Event> events;
+  for (size_t i = 0; i < batch; ++i) {
+    events.push_back(RandomEvent(n, rng));
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(P.Probability(std::span<const Event>(events)));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(1));
+}
+
+} // namespace
+
+BENCHMARK(BM_EventUnite)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(BM_EventIntersect)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(BM_EventComplement)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(BM_EventSize)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(BM_Probability)->RangeMultiplier(16)->Range(1 << 8, 1 << 20);
+BENCHMARK(BM_ProbabilityBatch)->ArgsProduct({{1 << 12, 1 << 16, 1 << 20}, {1, 16, 64}});
@@ -0,0 +1,113 @@
+#include "BatchRunner.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "lib/distributions/DistributionExperiment.hpp"
+#include "lib/law-of-large-numbers/LawOfLargeNumbersSimulator.hpp"
+#include "lib/markov-chain/MarkovTextModel.hpp"
+#include "lib/parallel/WorkStealingPool.hpp"
+
+namespace ptm {
+
+namespace {
+
+std::uint64_t SplitMix64(std::uint64_t x) {
+  x += 0x9E3779B97F4A7C15ULL;
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+  return x ^ (x >> 31);
+}
+
+void RunExperiment(const JobSpec& spec, std::size_t job, std::size_t repeat, std::mt19937& rng, ResultWriter& writer) {
+  DistributionExperiment experiment(MakeDistribution(spec), spec.Count("samples"));
+  const ExperimentStats stats = experiment.Run(rng);
+
+  const std::string_view kind = JobKindName(spec.kind);
+  const ResultRow rows[] = {
+      {job, repeat, kind, "mean", 0, stats.empirical_mean},
+      {job, repeat, kind, "variance", 0, stats.empirical_variance},
+      {job, repeat, kind, "mean_error", 0, stats.mean_error},
+      {job, repeat, kind, "variance_error", 0, stats.variance_error},
+  };
+  writer.Write(rows);
+}
+
+void RunLawOfLargeNumbers(const JobSpec& spec,
+                          std::size_t job,
+                          std::size_t repeat,
+                          std::mt19937& rng,
+                          ResultWriter& writer) {
+  LawOfLargeNumbersSimulator simulator(MakeDistribution(spec));
+  const LLNPathResult path = simulator.Simulate(rng, spec.Count("max_n"), spec.Count("step"));
+
+  const std::string_view kind = JobKindName(spec.kind);
+  std::vector<ResultRow> rows;
+  rows.reserve(2 * path.entries.size());
+  for (const LLNPathEntry& entry : path.entries) {
+    rows.push_back({job, repeat, kind, "sample_mean", entry.n, entry.sample_mean});
+    rows.push_back({job, repeat, kind, "abs_error", entry.n, entry.abs_error});
+  }
+  writer.Write(rows);
+}
+
+void RunMarkovCorpus(const JobSpec& spec, std::size_t job, ResultWriter& writer) {
+  std::ifstream in(spec.target, std::ios::binary);
+  if (!in) {
+    throw std::runtime_error("line " + std::to_string(spec.line) + ": cannot open corpus " + spec.target);
+  }
+  std::stringstream buffer;
+  buffer << in.rdbuf();
+  const std::string text = buffer.str();
+
+  // level уже проверен в ParseJobSpecs: word или char
+  const std::string_view level = spec.Text("level", "word");
+  MarkovTextModel model(level == "word" ? MarkovTextModel::TokenLevel::Word : MarkovTextModel::TokenLevel::Character);
+  model.TrainFromText(text);
+  const TextScore score = model.Score(text, Smoothing{.kind = SmoothingKind::AddK, .k = spec.Number("k", 1.0)});
+
+  const std::string_view kind = JobKindName(spec.kind);
+  const ResultRow rows[] = {
+      {job, 0, kind, "tokens", 0, static_cast<double>(score.num_transitions + 1)},
+      {job, 0, kind, "states", 0, static_cast<double>(model.Chain().GetStateCount())},
+      {job, 0, kind, "log_likelihood", 0, score.log_likelihood},
+      {job, 0, kind, "perplexity", 0, score.perplexity},
+  };
+  writer.Write(rows);
+}
+
+} // namespace
+
+std::mt19937 MakeJobRng(std::uint64_t seed, std::size_t job, std::size_t repeat) {
+  const std::uint64_t stream = SplitMix64(SplitMix64(seed ^ SplitMix64(job)) + repeat);
+  std::seed_seq seq{static_cast<std::uint32_t>(stream), static_cast<std::uint32_t>(stream >> 32)};
+  return std::mt19937(seq);
+}
+
+void RunBatch(const std::vector<JobSpec>& jobs, ResultWriter& writer, const BatchOptions& options) {
+  WorkStealingPool pool(options.num_threads);
+
+  for (std::size_t job = 0; job < jobs.size(); ++job) {
+    const JobSpec& spec = jobs[job];
+    if (spec.kind == JobKind::MarkovCorpus) {
+      pool.Submit([&spec, job, &writer] { RunMarkovCorpus(spec, job, writer); });
+      continue;
+    }
+
+    for (std::size_t repeat = 0, repeats = spec.Count("repeats", 1); repeat < repeats; ++repeat) {
+      pool.Submit([&spec, job, repeat, &writer, seed = options.seed] {
+        std::mt19937 rng = MakeJobRng(seed, job, repeat);
+        if (spec.kind == JobKind::Experiment) {
+          RunExperiment(spec, job, repeat, rng, writer);
+        } else {
+          RunLawOfLargeNumbers(spec, job, repeat, rng, writer);
+        }
+      });
+    }
+  }
+  pool.Wait();
+}
+
+} // namespace ptm
@@ -0,0 +1,28 @@
+#ifndef PTM_BATCHRUNNER_HPP_
+#define PTM_BATCHRUNNER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "JobSpec.hpp"
+#include "ResultWriter.hpp"
+
+namespace ptm {
+
+struct BatchOptions {
+  std::size_t num_threads = 0; // 0 - по числу ядер
+  std::uint64_t seed = 42;
+};
+
+// Зерно генератора для повтора repeat задания job: не зависит ни от числа потоков, ни от порядка выполнения
+std::mt19937 MakeJobRng(std::uint64_t seed, std::size_t job, std::size_t repeat);
+
+// Каждый повтор каждого задания - отдельная задача общего пула; результаты пишутся по мере готовности.
+// Задания должны быть получены из ParseJobSpecs: параметры повторно не проверяются
+void RunBatch(const std::vector<JobSpec>& jobs, ResultWriter& writer, const BatchOptions& options);
+
+} // namespace ptm
+
+#endif // PTM_BATCHRUNNER_HPP_
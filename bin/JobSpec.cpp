@@ -0,0 +1,213 @@
+#include "JobSpec.hpp"
+
+#include <charconv>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <stdexcept>
+
+#include "lib/distributions/BernoulliDistribution.hpp"
+#include "lib/distributions/BinomialDistribution.hpp"
+#include "lib/distributions/CauchyDistribution.hpp"
+#include "lib/distributions/ExponentialDistribution.hpp"
+#include "lib/distributions/GeometricDistribution.hpp"
+#include "lib/distributions/LaplaceDistribution.hpp"
+#include "lib/distributions/NormalDistribution.hpp"
+#include "lib/distributions/PoissonDistribution.hpp"
+#include "lib/distributions/UniformDistribution.hpp"
+
+namespace ptm {
+
+namespace {
+
+[[noreturn]] void Fail(std::size_t line, const std::string& message) {
+  throw std::invalid_argument("line " + std::to_string(line) + ": " + message);
+}
+
+std::size_t PositiveCount(const JobSpec& spec, std::string_view key) {
+  const std::size_t value = spec.Count(key);
+  if (value == 0) {
+    Fail(spec.line, "parameter '" + std::string(key) + "' must be positive");
+  }
+  return value;
+}
+
+// Всё, что задание прочитает при запуске, проверяется до запуска пула и до начала вывода
+void ValidateJob(const JobSpec& spec) {
+  (void)spec.Count("repeats", 1);
+  switch (spec.kind) {
+    case JobKind::Experiment:
+      (void)PositiveCount(spec, "samples");
+      (void)MakeDistribution(spec);
+      break;
+    case JobKind::LawOfLargeNumbers:
+      (void)PositiveCount(spec, "max_n");
+      (void)PositiveCount(spec, "step");
+      (void)MakeDistribution(spec);
+      break;
+    case JobKind::MarkovCorpus: {
+      const std::string_view level = spec.Text("level", "word");
+      if (level != "word" && level != "char") {
+        Fail(spec.line, "level must be word or char");
+      }
+      if (!(spec.Number("k", 1.0) > 0.0)) {
+        Fail(spec.line, "parameter 'k' must be positive");
+      }
+      break;
+    }
+  }
+}
+
+} // namespace
+
+bool JobSpec::Has(std::string_view key) const {
+  return params.find(key) != params.end();
+}
+
+double JobSpec::Number(std::string_view key) const {
+  auto it = params.find(key);
+  if (it == params.end()) {
+    Fail(line, "missing parameter '" + std::string(key) + "'");
+  }
+
+  // std::from_chars для double есть не во всех стандартных библиотеках
+  std::istringstream in(it->second);
+  in.imbue(std::locale::classic());
+  double value = 0.0;
+  if (!(in >> value) || !in.eof()) {
+    Fail(line, "parameter '" + std::string(key) + "' is not a number: " + it->second);
+  }
+  return value;
+}
+
+double JobSpec::Number(std::string_view key, double fallback) const {
+  return Has(key) ? Number(key) : fallback;
+}
+
+std::size_t JobSpec::Count(std::string_view key) const {
+  auto it = params.find(key);
+  if (it == params.end()) {
+    Fail(line, "missing parameter '" + std::string(key) + "'");
+  }
+
+  const std::string& text = it->second;
+  std::size_t value = 0;
+  auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+  if (error != std::errc{} || end != text.data() + text.size()) {
+    Fail(line, "parameter '" + std::string(key) + "' is not a non-negative integer: " + text);
+  }
+  return value;
+}
+
+std::size_t JobSpec::Count(std::string_view key, std::size_t fallback) const {
+  return Has(key) ? Count(key) : fallback;
+}
+
+std::string_view JobSpec::Text(std::string_view key, std::string_view fallback) const {
+  auto it = params.find(key);
+  return it == params.end() ? fallback : std::string_view(it->second);
+}
+
+std::string_view JobKindName(JobKind kind) noexcept {
+  switch (kind) {
+    case JobKind::Experiment:
+      return "experiment";
+    case JobKind::LawOfLargeNumbers:
+      return "lln";
+    case JobKind::MarkovCorpus:
+      return "markov";
+  }
+  return "";
+}
+
+std::vector<JobSpec> ParseJobSpecs(std::istream& in, const std::filesystem::path& base_dir) {
+  std::vector<JobSpec> jobs;
+  std::string text;
+  for (std::size_t line = 1; std::getline(in, text); ++line) {
+    std::istringstream words(text);
+    std::string kind;
+    if (!(words >> kind) || kind.front() == '#') {
+      continue;
+    }
+
+    JobSpec spec;
+    spec.line = line;
+    if (kind == "experiment") {
+      spec.kind = JobKind::Experiment;
+    } else if (kind == "lln") {
+      spec.kind = JobKind::LawOfLargeNumbers;
+    } else if (kind == "markov") {
+      spec.kind = JobKind::MarkovCorpus;
+    } else {
+      Fail(line, "unknown job kind '" + kind + "'");
+    }
+
+    if (!(words >> spec.target)) {
+      Fail(line, "job target is missing");
+    }
+    for (std::string param; words >> param;) {
+      const std::size_t eq = param.find('=');
+      if (eq == std::string::npos || eq == 0) {
+        Fail(line, "expected key=value, got '" + param + "'");
+      }
+      spec.params.insert_or_assign(param.substr(0, eq), param.substr(eq + 1));
+    }
+
+    if (spec.kind == JobKind::MarkovCorpus) {
+      std::filesystem::path corpus(spec.target);
+      if (corpus.is_relative() && !base_dir.empty()) {
+        spec.target = (base_dir / corpus).string();
+      }
+    }
+    ValidateJob(spec);
+    jobs.push_back(std::move(spec));
+  }
+  return jobs;
+}
+
+std::shared_ptr<Distribution> MakeDistribution(const JobSpec& spec) {
+  const std::string& name = spec.target;
+  try {
+    if (name == "normal") {
+      return std::make_shared<NormalDistribution>(spec.Number("mean"), spec.Number("stddev"));
+    }
+    if (name == "uniform") {
+      return std::make_shared<UniformDistribution>(spec.Number("a"), spec.Number("b"));
+    }
+    if (name == "exponential") {
+      return std::make_shared<ExponentialDistribution>(spec.Number("lambda"));
+    }
+    if (name == "cauchy") {
+      return std::make_shared<CauchyDistribution>(spec.Number("x0"), spec.Number("gamma"));
+    }
+    if (name == "laplace") {
+      return std::make_shared<LaplaceDistribution>(spec.Number("mu"), spec.Number("b"));
+    }
+    if (name == "bernoulli") {
+      return std::make_shared<BernoulliDistribution>(spec.Number("p"));
+    }
+    if (name == "binomial") {
+      const std::size_t n = spec.Count("n");
+      if (n > std::numeric_limits<unsigned int>::max()) {
+        Fail(spec.line, "binomial: n must not exceed " + std::to_string(std::numeric_limits<unsigned int>::max()));
+      }
+      return std::make_shared<BinomialDistribution>(static_cast<unsigned int>(n), spec.Number("p"));
+    }
+    if (name == "geometric") {
+      return std::make_shared<GeometricDistribution>(spec.Number("p"));
+    }
+    if (name == "poisson") {
+      return std::make_shared<PoissonDistribution>(spec.Number("lambda"));
+    }
+  } catch (const std::invalid_argument& e) {
+    const std::string message = e.what();
+    // Ошибки Number/Count уже содержат номер строки
+    if (message.starts_with("line ")) {
+      throw;
+    }
+    Fail(spec.line, name + ": " + message);
+  }
+  Fail(spec.line, "unknown distribution '" + name + "'");
+}
+
+} // namespace ptm
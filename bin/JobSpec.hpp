@@ -0,0 +1,49 @@
+#ifndef PTM_JOBSPEC_HPP_
+#define PTM_JOBSPEC_HPP_
+
+#include <cstddef>
+#include <filesystem>
+#include <istream>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "lib/distributions/Distribution.hpp"
+
+namespace ptm {
+
+enum class JobKind { Experiment, LawOfLargeNumbers, MarkovCorpus }; // NOLINT
+
+// Одна строка файла заданий:
+//   experiment <распределение> samples=N [repeats=R] <параметры распределения>
+//   lln        <распределение> max_n=N step=S [repeats=R] <параметры распределения>
+//   markov     <путь к корпусу> [level=word|char] [k=1]
+// Пустые строки и строки, начинающиеся с '#', пропускаются
+struct JobSpec {
+  JobKind kind = JobKind::Experiment;
+  std::string target;
+  std::map<std::string, std::string, std::less<>> params;
+  std::size_t line = 0;
+
+  [[nodiscard]] bool Has(std::string_view key) const;
+  // Бросают std::invalid_argument с номером строки, если параметра нет или он не число
+  [[nodiscard]] double Number(std::string_view key) const;
+  [[nodiscard]] double Number(std::string_view key, double fallback) const;
+  [[nodiscard]] std::size_t Count(std::string_view key) const;
+  [[nodiscard]] std::size_t Count(std::string_view key, std::size_t fallback) const;
+  [[nodiscard]] std::string_view Text(std::string_view key, std::string_view fallback) const;
+};
+
+[[nodiscard]] std::string_view JobKindName(JobKind kind) noexcept;
+
+// Относительные пути корпусов разрешаются от base_dir
+std::vector<JobSpec> ParseJobSpecs(std::istream& in, const std::filesystem::path& base_dir = {});
+
+// normal, uniform, exponential, cauchy, laplace, bernoulli, binomial, geometric, poisson
+std::shared_ptr<Distribution> MakeDistribution(const JobSpec& spec);
+
+} // namespace ptm
+
+#endif // PTM_JOBSPEC_HPP_
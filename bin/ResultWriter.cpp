@@ -0,0 +1,61 @@
+#include "ResultWriter.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <locale>
+
+namespace ptm {
+
+namespace {
+
+template <typename T>
+void WriteRaw(std::ostream& out, T value) {
+  out.write(reinterpret_cast<const char*>(&value), sizeof(value)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+void WriteShortString(std::ostream& out, std::string_view s) {
+  const auto length =
+      static_cast<std::uint8_t>(std::min<std::size_t>(s.size(), std::numeric_limits<std::uint8_t>::max()));
+  WriteRaw(out, length);
+  out.write(s.data(), length);
+}
+
+} // namespace
+
+void ResultWriter::Write(std::span<const ResultRow> rows) {
+  std::lock_guard lock(mutex_);
+  writeRows(rows);
+}
+
+CsvResultWriter::CsvResultWriter(std::ostream& out) : out_(out) {
+  out_.imbue(std::locale::classic());
+  out_.precision(std::numeric_limits<double>::max_digits10);
+  out_ << "job,repeat,kind,metric,index,value\n";
+}
+
+void CsvResultWriter::writeRows(std::span<const ResultRow> rows) {
+  for (const ResultRow& row : rows) {
+    out_ << row.job << ',' << row.repeat << ',' << row.kind << ',' << row.metric << ',' << row.index << ','
+         << row.value << '\n';
+  }
+  out_.flush();
+}
+
+BinaryResultWriter::BinaryResultWriter(std::ostream& out) : out_(out) {
+  out_.write("PTMR", 4);
+  WriteRaw(out_, kVersion);
+}
+
+void BinaryResultWriter::writeRows(std::span<const ResultRow> rows) {
+  for (const ResultRow& row : rows) {
+    WriteRaw(out_, static_cast<std::uint64_t>(row.job));
+    WriteRaw(out_, static_cast<std::uint64_t>(row.repeat));
+    WriteRaw(out_, row.index);
+    WriteRaw(out_, row.value);
+    WriteShortString(out_, row.kind);
+    WriteShortString(out_, row.metric);
+  }
+  out_.flush();
+}
+
+} // namespace ptm
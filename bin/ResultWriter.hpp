@@ -0,0 +1,68 @@
+#ifndef PTM_RESULTWRITER_HPP_
+#define PTM_RESULTWRITER_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <span>
+#include <string_view>
+
+namespace ptm {
+
+// Одно числовое значение результата. index - номер точки траектории (n для lln), иначе 0
+struct ResultRow {
+  std::size_t job = 0;
+  std::size_t repeat = 0;
+  std::string_view kind;
+  std::string_view metric;
+  std::uint64_t index = 0;
+  double value = 0.0;
+};
+
+// Потоковая запись результатов по мере завершения заданий. Строки одного вызова Write
+// идут подряд, вызовы из разных потоков сериализуются
+class ResultWriter { // NOLINT(cppcoreguidelines-special-member-functions)
+public:
+  virtual ~ResultWriter() = default;
+
+  void Write(std::span<const ResultRow> rows);
+
+protected:
+  virtual void writeRows(std::span<const ResultRow> rows) = 0;
+
+private:
+  std::mutex mutex_;
+};
+
+// job,repeat,kind,metric,index,value
+class CsvResultWriter : public ResultWriter {
+public:
+  explicit CsvResultWriter(std::ostream& out);
+
+protected:
+  void writeRows(std::span<const ResultRow> rows) override;
+
+private:
+  std::ostream& out_;
+};
+
+// Заголовок "PTMR" и версия (uint32), затем записи:
+// job u64, repeat u64, index u64, value f64, длина kind u8 + kind, длина metric u8 + metric.
+// Числа в порядке байт машины
+class BinaryResultWriter : public ResultWriter {
+public:
+  static constexpr std::uint32_t kVersion = 1;
+
+  explicit BinaryResultWriter(std::ostream& out);
+
+protected:
+  void writeRows(std::span<const ResultRow> rows) override;
+
+private:
+  std::ostream& out_;
+};
+
+} // namespace ptm
+
+#endif // PTM_RESULTWRITER_HPP_
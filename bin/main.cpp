@@ -1,6 +1,109 @@
 #include <cstdint>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "BatchRunner.hpp"
+#include "JobSpec.hpp"
+#include "ResultWriter.hpp"
+
+namespace {
+
+constexpr std::string_view kUsage =
+    "Usage: cpp_tests --jobs FILE [--format csv|binary] [--output FILE] [--threads N] [--seed N]\n"
+    "\n"
+    "Runs every job from FILE on a shared thread pool and streams results as they finish.\n"
+    "\n"
+    "Job file lines ('#' starts a comment):\n"
+    "  experiment <distribution> samples=N [repeats=R] <parameters>\n"
+    "  lln        <distribution> max_n=N step=S [repeats=R] <parameters>\n"
+    "  markov     <corpus path> [level=word|char] [k=1]\n"
+    "\n"
+    "Distributions: normal mean= stddev=, uniform a= b=, exponential lambda=, cauchy x0= gamma=,\n"
+    "  laplace mu= b=, bernoulli p=, binomial n= p=, geometric p=, poisson lambda=\n"
+    "\n"
+    "Options:\n"
+    "  --format   csv (default) or binary\n"
+    "  --output   output file, stdout by default\n"
+    "  --threads  worker threads, 0 (default) - one per core\n"
+    "  --seed     base seed; job seeds do not depend on scheduling (default 42)\n";
+
+} // namespace
 
 int main(std::int32_t argc, char** argv) {
-  // You can add anything you want here
+  std::string jobs_path;
+  std::string output_path;
+  std::string format = "csv";
+  ptm::BatchOptions options;
+
+  try {
+    for (std::int32_t i = 1; i < argc; ++i) {
+      const std::string_view arg = argv[i];
+      if (arg == "--help" || arg == "-h") {
+        std::cout << kUsage;
+        return 0;
+      }
+      if (i + 1 >= argc) {
+        std::cerr << "Missing value for " << arg << "\n\n" << kUsage;
+        return 1;
+      }
+
+      const std::string value = argv[++i];
+      if (arg == "--jobs") {
+        jobs_path = value;
+      } else if (arg == "--output") {
+        output_path = value;
+      } else if (arg == "--format") {
+        format = value;
+      } else if (arg == "--threads") {
+        options.num_threads = std::stoul(value);
+      } else if (arg == "--seed") {
+        options.seed = std::stoull(value);
+      } else {
+        std::cerr << "Unknown option " << arg << "\n\n" << kUsage;
+        return 1;
+      }
+    }
+
+    if (jobs_path.empty()) {
+      std::cout << kUsage;
+      return 0;
+    }
+    if (format != "csv" && format != "binary") {
+      std::cerr << "Unknown format " << format << "\n";
+      return 1;
+    }
+
+    std::ifstream jobs_file(jobs_path);
+    if (!jobs_file) {
+      std::cerr << "Cannot open job file " << jobs_path << "\n";
+      return 1;
+    }
+    const auto jobs = ptm::ParseJobSpecs(jobs_file, std::filesystem::path(jobs_path).parent_path());
+
+    std::ofstream output_file;
+    if (!output_path.empty()) {
+      output_file.open(output_path, std::ios::binary);
+      if (!output_file) {
+        std::cerr << "Cannot open output file " << output_path << "\n";
+        return 1;
+      }
+    }
+    std::ostream& out = output_path.empty() ? std::cout : output_file;
+
+    std::unique_ptr<ptm::ResultWriter> writer;
+    if (format == "csv") {
+      writer = std::make_unique<ptm::CsvResultWriter>(out);
+    } else {
+      writer = std::make_unique<ptm::BinaryResultWriter>(out);
+    }
+    ptm::RunBatch(jobs, *writer, options);
+  } catch (const std::exception& e) {
+    std::cerr << "Error: " << e.what() << "\n";
+    return 1;
+  }
   return 0;
 }
@@ -11,3 +11,24 @@ FetchContent_Declare(
 )
 
 FetchContent_MakeAvailable(googletest)
+
+# Google Benchmark
+option(PTM_BUILD_BENCHMARKS "Build the Google Benchmark suite" OFF)
+
+if(PTM_BUILD_BENCHMARKS)
+    find_package(benchmark QUIET)
+
+    if(NOT benchmark_FOUND)
+        set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+        set(BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE BOOL "" FORCE)
+        set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+
+        FetchContent_Declare(
+            benchmark
+            GIT_REPOSITORY https://github.com/google/benchmark.git
+            GIT_TAG v1.8.3
+        )
+
+        FetchContent_MakeAvailable(benchmark)
+    endif()
+endif()
@@ -1 +1,50 @@
 #include "BernoulliDistribution.hpp"
+
+#include <stdexcept>
+
+namespace ptm {
+
+BernoulliDistribution::BernoulliDistribution(double p) : p_(p) {
+  if (!(p >= 0.0 && p <= 1.0)) {
+    throw std::invalid_argument("Bernoulli distribution requires 0 <= p <= 1");
+  }
+}
+
+double BernoulliDistribution::Pdf(double x) const {
+  if (x == 0.0) {
+    return 1.0 - p_;
+  }
+  if (x == 1.0) {
+    return p_;
+  }
+  return 0.0;
+}
+
+double BernoulliDistribution::Cdf(double x) const {
+  if (x < 0.0) {
+    return 0.0;
+  }
+  if (x < 1.0) {
+    return 1.0 - p_;
+  }
+  return 1.0;
+}
+
+double BernoulliDistribution::Quantile(double u) const {
+  checkQuantileLevel(u);
+  return u <= 1.0 - p_ ? 0.0 : 1.0;
+}
+
+double BernoulliDistribution::Sample(std::mt19937& rng) const {
+  return std::bernoulli_distribution(p_)(rng) ? 1.0 : 0.0;
+}
+
+double BernoulliDistribution::TheoreticalMean() const {
+  return p_;
+}
+
+double BernoulliDistribution::TheoreticalVariance() const {
+  return p_ * (1.0 - p_);
+}
+
+} // namespace ptm
@@ -1 +1,71 @@
 #include "BinomialDistribution.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "SpecialFunctions.hpp"
+
+namespace ptm {
+
+BinomialDistribution::BinomialDistribution(unsigned int n, double p) : n_(n), p_(p) {
+  if (!(p >= 0.0 && p <= 1.0)) {
+    throw std::invalid_argument("Binomial distribution requires 0 <= p <= 1");
+  }
+  if (n_ > 0 && p_ > 0.0 && p_ < 1.0) {
+    const double n = n_;
+    const double odds = p_ / (1.0 - p_);
+    const double mode = std::min(std::floor((n + 1.0) * p_), n);
+    table_ = DiscreteQuantileTable::Around(
+        mode, BinomialDistribution::Pdf(mode), 0.0, n, [n, odds](double k) { return (n - k) / (k + 1.0) * odds; },
+        [this](double k) { return BinomialDistribution::Cdf(k); });
+  }
+}
+
+double BinomialDistribution::Pdf(double x) const {
+  if (x < 0.0 || x > n_ || std::floor(x) != x) {
+    return 0.0;
+  }
+  return BinomialPmf(static_cast<std::uint64_t>(x), n_, p_);
+}
+
+double BinomialDistribution::Cdf(double x) const {
+  if (x < 0.0) {
+    return 0.0;
+  }
+  if (x >= n_ || p_ == 0.0) {
+    return 1.0;
+  }
+  if (p_ == 1.0) {
+    return 0.0;
+  }
+
+  // P(X <= k) = I_{1-p}(n - k, k + 1)
+  const double k = std::floor(x);
+  return RegularizedIncompleteBeta(static_cast<double>(n_) - k, k + 1.0, 1.0 - p_);
+}
+
+double BinomialDistribution::Quantile(double u) const {
+  checkQuantileLevel(u);
+  if (const auto k = table_.Find(u)) {
+    return *k;
+  }
+  // Старт с нормального приближения, дальше несколько вычислений Cdf
+  const double z = StandardNormalQuantile(std::clamp(u, 1e-300, 1.0 - 1e-16));
+  const double guess = TheoreticalMean() + std::sqrt(TheoreticalVariance()) * z;
+  return discreteQuantile(u, guess, 0.0, static_cast<double>(n_));
+}
+
+double BinomialDistribution::Sample(std::mt19937& rng) const {
+  return std::binomial_distribution<unsigned int>(n_, p_)(rng);
+}
+
+double BinomialDistribution::TheoreticalMean() const {
+  return n_ * p_;
+}
+
+double BinomialDistribution::TheoreticalVariance() const {
+  return n_ * p_ * (1.0 - p_);
+}
+
+} // namespace ptm
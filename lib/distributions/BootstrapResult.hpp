@@ -0,0 +1,37 @@
+#ifndef PTM_BOOTSTRAPRESULT_HPP_
+#define PTM_BOOTSTRAPRESULT_HPP_
+
+#include <cstddef>
+
+namespace ptm {
+
+// Как перевзвешивается выборка в одном бутстреп-повторе
+enum class ResamplingScheme { // NOLINT
+  Multinomial, // n индексов с возвращением - классический бутстреп
+  Poisson      // независимые веса Poisson(1), размер повтора случаен
+};
+
+struct ConfidenceInterval {
+  double lower = 0.0;
+  double upper = 0.0;
+};
+
+struct BootstrapEstimate {
+  double estimate = 0.0;       // значение на исходной выборке
+  double standard_error = 0.0; // стандартное отклонение бутстреп-повторов
+  ConfidenceInterval percentile;
+  ConfidenceInterval bca; // с поправкой на смещение и ускорение
+};
+
+struct BootstrapResult {
+  std::size_t num_resamples = 0;
+  double confidence = 0.0;
+  BootstrapEstimate mean;
+  BootstrapEstimate variance;
+  // Расстояние Колмогорова на сетке из различных значений выборки
+  BootstrapEstimate kolmogorov_distance;
+};
+
+} // namespace ptm
+
+#endif // PTM_BOOTSTRAPRESULT_HPP_
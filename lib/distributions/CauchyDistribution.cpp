@@ -1 +1,46 @@
 #include "CauchyDistribution.hpp"
+
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <stdexcept>
+
+namespace ptm {
+
+CauchyDistribution::CauchyDistribution(double x0, double gamma) : x0_(x0), gamma_(gamma) {
+  if (!(gamma > 0.0)) {
+    throw std::invalid_argument("Cauchy distribution requires gamma > 0");
+  }
+}
+
+double CauchyDistribution::Pdf(double x) const {
+  const double z = (x - x0_) / gamma_;
+  return 1.0 / (std::numbers::pi * gamma_ * (1.0 + z * z));
+}
+
+double CauchyDistribution::Cdf(double x) const {
+  return 0.5 + std::atan((x - x0_) / gamma_) / std::numbers::pi;
+}
+
+double CauchyDistribution::Quantile(double u) const {
+  checkQuantileLevel(u);
+  if (u == 0.0 || u == 1.0) {
+    return u == 0.0 ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::infinity();
+  }
+  return x0_ + gamma_ * std::tan(std::numbers::pi * (u - 0.5));
+}
+
+double CauchyDistribution::Sample(std::mt19937& rng) const {
+  return std::cauchy_distribution<double>(x0_, gamma_)(rng);
+}
+
+// Матожидание и дисперсия у распределения Коши не определены
+double CauchyDistribution::TheoreticalMean() const {
+  return std::numeric_limits<double>::quiet_NaN();
+}
+
+double CauchyDistribution::TheoreticalVariance() const {
+  return std::numeric_limits<double>::quiet_NaN();
+}
+
+} // namespace ptm
@@ -0,0 +1,57 @@
+#include "DiscreteQuantileTable.hpp"
+
+#include <algorithm>
+
+namespace ptm {
+
+DiscreteQuantileTable::DiscreteQuantileTable(double first, double cdf_below, const std::vector<double>& pmfs) :
+    first_(first),
+    cdf_below_(cdf_below),
+    cdf_(pmfs.size()) {
+  double sum = cdf_below_;
+  for (std::size_t i = 0; i < pmfs.size(); ++i) {
+    sum += pmfs[i];
+    cdf_[i] = sum;
+  }
+
+  // Одна направляющая на точку таблицы: в среднем O(1) шагов от направляющей до ответа
+  const double span = cdf_.back() - cdf_below_;
+  scale_ = static_cast<double>(cdf_.size()) / span;
+  guide_.resize(cdf_.size());
+  std::size_t i = 0;
+  for (std::size_t j = 0; j < guide_.size(); ++j) {
+    const double level = cdf_below_ + static_cast<double>(j) / scale_;
+    while (i + 1 < cdf_.size() && cdf_[i] < level) {
+      ++i;
+    }
+    guide_[j] = i;
+  }
+}
+
+std::optional<double> DiscreteQuantileTable::Find(double u) const {
+  if (cdf_.empty() || !(u > cdf_below_ + kTolerance && u < cdf_.back() - kTolerance)) {
+    return std::nullopt;
+  }
+
+  const auto j = static_cast<std::size_t>((u - cdf_below_) * scale_);
+  std::size_t i = guide_[std::min(j, guide_.size() - 1)];
+  // Направляющая может оказаться на шаг правее из-за округления (u - cdf_below_) * scale_
+  while (i > 0 && cdf_[i - 1] >= u) {
+    --i;
+  }
+  while (cdf_[i] < u) {
+    ++i;
+  }
+
+  const double previous = i == 0 ? cdf_below_ : cdf_[i - 1];
+  if (cdf_[i] - u < kTolerance || u - previous < kTolerance) {
+    return std::nullopt;
+  }
+  return first_ + static_cast<double>(i);
+}
+
+bool DiscreteQuantileTable::IsEmpty() const noexcept {
+  return cdf_.empty();
+}
+
+} // namespace ptm
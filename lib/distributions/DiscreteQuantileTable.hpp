@@ -0,0 +1,86 @@
+#ifndef PTM_DISCRETEQUANTILETABLE_HPP_
+#define PTM_DISCRETEQUANTILETABLE_HPP_
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace ptm {
+
+// Таблица функции распределения целочисленной величины на основной части носителя.
+// Вероятности строятся от моды по рекуррентности P(k + 1) = P(k) * ratio(k), поиск по
+// таблице направляющих (Chen-Asau) стоит O(1) вместо нескольких вычислений Cdf
+class DiscreteQuantileTable {
+public:
+  // Не больше стольких точек; для более широкого носителя таблица остаётся пустой
+  static constexpr std::size_t kMaxSize = std::size_t{1} << 16;
+
+  DiscreteQuantileTable() = default;
+
+  // mode_pmf = P(mode), ratio(k) = P(k + 1) / P(k), cdf(k) = P(X <= k) - для привязки к хвосту.
+  // Носитель обрезается там, где P(k) < 1e-16 * P(mode)
+  template <typename Ratio, typename Cdf>
+  static DiscreteQuantileTable Around(double mode, double mode_pmf, double lower, double upper, Ratio ratio, Cdf cdf) {
+    if (!(mode_pmf > 0.0)) {
+      return {};
+    }
+    const double threshold = mode_pmf * kRelativeCutoff;
+
+    std::vector<double> below;
+    double pmf = mode_pmf;
+    for (double k = mode; k > lower;) {
+      pmf /= ratio(k - 1.0);
+      if (!(pmf >= threshold)) {
+        break;
+      }
+      if (below.size() == kMaxSize) {
+        return {};
+      }
+      below.push_back(pmf);
+      k -= 1.0;
+    }
+
+    std::vector<double> pmfs(below.rbegin(), below.rend());
+    pmfs.push_back(mode_pmf);
+    pmf = mode_pmf;
+    for (double k = mode; k < upper;) {
+      pmf *= ratio(k);
+      if (!(pmf >= threshold)) {
+        break;
+      }
+      if (pmfs.size() == kMaxSize) {
+        return {};
+      }
+      pmfs.push_back(pmf);
+      k += 1.0;
+    }
+
+    const double first = mode - static_cast<double>(below.size());
+    return {first, first > lower ? cdf(first - 1.0) : 0.0, pmfs};
+  }
+
+  // Наименьшее k с F(k) >= u, если u попадает в таблицу. std::nullopt в хвостах и рядом со
+  // ступенькой F, где накопленная ошибка суммы может дать соседнее k, - там нужен точный поиск
+  [[nodiscard]] std::optional<double> Find(double u) const;
+
+  [[nodiscard]] bool IsEmpty() const noexcept;
+
+private:
+  static constexpr double kRelativeCutoff = 1e-16;
+  // Ошибка префиксных сумм на 2^16 точках порядка 1e-11
+  static constexpr double kTolerance = 1e-9;
+
+  double first_ = 0.0;
+  double cdf_below_ = 0.0;
+  // cdf_[i] = F(first_ + i)
+  std::vector<double> cdf_;
+  // guide_[j] - первый индекс с cdf_[i] >= cdf_below_ + j / scale_
+  std::vector<std::size_t> guide_;
+  double scale_ = 0.0;
+
+  DiscreteQuantileTable(double first, double cdf_below, const std::vector<double>& pmfs);
+};
+
+} // namespace ptm
+
+#endif // PTM_DISCRETEQUANTILETABLE_HPP_
@@ -0,0 +1,106 @@
+#include "Distribution.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace ptm {
+
+namespace {
+
+constexpr int kMaxBisectionSteps = 200;
+constexpr double kRelativeTolerance = 1e-13;
+
+} // namespace
+
+void Distribution::checkQuantileLevel(double u) {
+  if (!(u >= 0.0 && u <= 1.0)) {
+    throw std::invalid_argument("Quantile level must be in [0, 1]");
+  }
+}
+
+double Distribution::Quantile(double u) const {
+  checkQuantileLevel(u);
+  if (u == 0.0) {
+    return -std::numeric_limits<double>::infinity();
+  }
+  if (u == 1.0) {
+    return std::numeric_limits<double>::infinity();
+  }
+
+  double center = TheoreticalMean();
+  if (!std::isfinite(center)) {
+    center = 0.0;
+  }
+  double scale = std::sqrt(TheoreticalVariance());
+  if (!std::isfinite(scale) || scale <= 0.0) {
+    scale = 1.0;
+  }
+
+  // Расширение отрезка в обе стороны, пока он не накроет квантиль
+  double lo = center - scale;
+  for (double step = scale; Cdf(lo) >= u; step *= 2.0) {
+    lo -= step;
+    if (!std::isfinite(lo)) {
+      return lo;
+    }
+  }
+  double hi = center + scale;
+  for (double step = scale; Cdf(hi) < u; step *= 2.0) {
+    hi += step;
+    if (!std::isfinite(hi)) {
+      return hi;
+    }
+  }
+
+  for (int i = 0; i < kMaxBisectionSteps; ++i) {
+    const double mid = lo + (hi - lo) / 2.0;
+    if (mid <= lo || mid >= hi || hi - lo <= kRelativeTolerance * std::max(1.0, std::abs(mid))) {
+      break;
+    }
+    (Cdf(mid) >= u ? hi : lo) = mid;
+  }
+  return hi;
+}
+
+double Distribution::discreteQuantile(double u, double guess, double lower, double upper) const {
+  double k = std::clamp(std::round(guess), lower, upper);
+  double lo = k;
+  double hi = k;
+
+  if (Cdf(k) >= u) {
+    // Вниз до точки с F < u
+    for (double step = 1.0;; step *= 2.0) {
+      lo = std::max(lower, hi - step);
+      if (Cdf(lo) < u) {
+        break;
+      }
+      if (lo == lower) {
+        return lower;
+      }
+      hi = lo;
+    }
+  } else {
+    // Вверх до точки с F >= u
+    for (double step = 1.0;; step *= 2.0) {
+      hi = std::min(upper, lo + step);
+      if (Cdf(hi) >= u) {
+        break;
+      }
+      if (hi == upper) {
+        return upper;
+      }
+      lo = hi;
+    }
+  }
+
+  // F(lo) < u <= F(hi)
+  while (hi - lo > 1.0) {
+    const double mid = lo + std::floor((hi - lo) / 2.0);
+    (Cdf(mid) >= u ? hi : lo) = mid;
+  }
+  return hi;
+}
+
+} // namespace ptm
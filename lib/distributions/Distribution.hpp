@@ -16,6 +16,10 @@ public:
   // F(x) = P(X <= x)
   [[nodiscard]] virtual double Cdf(double x) const = 0;
 
+  // Q(u) = inf{x : F(x) >= u}, u из [0, 1]. По умолчанию - бисекция по Cdf,
+  // распределения с явной формулой её переопределяют
+  [[nodiscard]] virtual double Quantile(double u) const;
+
   // Генерация выборочного значения
   virtual double Sample(std::mt19937& rng) const = 0;
 
@@ -23,6 +27,13 @@ public:
   // Для распределений, где это не определено - можно вернуть NaN.
   [[nodiscard]] virtual double TheoreticalMean() const = 0;
   [[nodiscard]] virtual double TheoreticalVariance() const = 0;
+
+protected:
+  // std::invalid_argument, если u не из [0, 1]
+  static void checkQuantileLevel(double u);
+
+  // Наименьшее целое k из [lower, upper] с F(k) >= u: шаги удваиваются от guess, затем бисекция
+  [[nodiscard]] double discreteQuantile(double u, double guess, double lower, double upper) const;
 };
 
 } // namespace ptm
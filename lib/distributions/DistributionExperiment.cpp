@@ -1 +1,338 @@
 #include "DistributionExperiment.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+#include "SpecialFunctions.hpp"
+#include "metrics/Metrics.hpp"
+#include "parallel/ParallelFor.hpp"
+
+namespace ptm {
+
+namespace {
+
+// Больше групп jackknife почти не уточняет ускорение BCa, а стоит по проходу по выборке на группу
+constexpr std::size_t kJackknifeGroups = 100;
+
+// Выборка бутстрепа, отсортированная один раз. Повторы отличаются только весами элементов
+struct SortedSample {
+  std::vector<double> deviations;        // x_i - x̄, сдвиг для устойчивой дисперсии
+  std::vector<std::uint32_t> groups;     // группа jackknife по порядку выборки, не по значению
+  std::vector<std::size_t> run_ends;     // конец серии одинаковых значений
+  std::vector<double> run_cdf;           // F(x) для значения серии
+  double mean = 0.0;
+};
+
+struct WeightedStats {
+  double mean = 0.0;
+  double variance = 0.0;
+  double kolmogorov_distance = 0.0;
+};
+
+// Статистики выборки с весами weight(i) за один проход
+template <typename Weight>
+WeightedStats ComputeWeighted(const SortedSample& sample, const Weight& weight) {
+  double total = 0.0;
+  double s1 = 0.0;
+  double s2 = 0.0;
+  for (std::size_t i = 0; i < sample.deviations.size(); ++i) {
+    const double w = weight(i);
+    const double d = sample.deviations[i];
+    total += w;
+    s1 += w * d;
+    s2 += w * d * d;
+  }
+
+  WeightedStats stats;
+  if (total <= 0.0) {
+    return stats;
+  }
+  stats.mean = sample.mean + s1 / total;
+  stats.variance = total > 1.0 ? std::max(s2 - s1 * s1 / total, 0.0) / (total - 1.0) : 0.0;
+
+  // ECDF прыгает в каждой серии: F сравнивается и с уровнем до прыжка, и с уровнем после
+  double cumulative = 0.0;
+  std::size_t begin = 0;
+  for (std::size_t run = 0; run < sample.run_ends.size(); ++run) {
+    const double before = cumulative / total;
+    for (std::size_t i = begin; i < sample.run_ends[run]; ++i) {
+      cumulative += weight(i);
+    }
+    begin = sample.run_ends[run];
+    const double after = cumulative / total;
+    const double cdf = sample.run_cdf[run];
+    stats.kolmogorov_distance = std::max({stats.kolmogorov_distance, std::abs(cdf - before), std::abs(cdf - after)});
+  }
+  return stats;
+}
+
+// Линейная интерполяция между порядковыми статистиками
+double SortedQuantile(const std::vector<double>& sorted, double q) {
+  const double position = q * static_cast<double>(sorted.size() - 1);
+  const auto lower = static_cast<std::size_t>(position);
+  const std::size_t upper = std::min(lower + 1, sorted.size() - 1);
+  return sorted[lower] + (position - static_cast<double>(lower)) * (sorted[upper] - sorted[lower]);
+}
+
+BootstrapEstimate Summarize(double estimate,
+                            std::vector<double> replicates,
+                            const std::vector<double>& jackknife,
+                            double confidence) {
+  BootstrapEstimate result;
+  result.estimate = estimate;
+
+  const auto count = static_cast<double>(replicates.size());
+  const double replicate_mean = std::accumulate(replicates.begin(), replicates.end(), 0.0) / count;
+  double squares = 0.0;
+  for (double r : replicates) {
+    squares += (r - replicate_mean) * (r - replicate_mean);
+  }
+  result.standard_error = replicates.size() > 1 ? std::sqrt(squares / (count - 1.0)) : 0.0;
+
+  std::ranges::sort(replicates);
+  const double alpha = (1.0 - confidence) / 2.0;
+  result.percentile = {SortedQuantile(replicates, alpha), SortedQuantile(replicates, 1.0 - alpha)};
+  result.bca = result.percentile;
+
+  // Поправка на смещение: доля повторов ниже оценки (совпадения считаются наполовину)
+  const auto below = std::ranges::lower_bound(replicates, estimate) - replicates.begin();
+  const auto not_above = std::ranges::upper_bound(replicates, estimate) - replicates.begin();
+  const double fraction = (static_cast<double>(below) + static_cast<double>(not_above)) / (2.0 * count);
+  if (fraction <= 0.0 || fraction >= 1.0) {
+    return result;
+  }
+  const double z0 = StandardNormalQuantile(fraction);
+
+  // Ускорение - асимметрия jackknife-оценок
+  const double jackknife_mean = std::accumulate(jackknife.begin(), jackknife.end(), 0.0) /
+                                static_cast<double>(jackknife.size());
+  double num = 0.0;
+  double den = 0.0;
+  for (double value : jackknife) {
+    const double d = jackknife_mean - value;
+    num += d * d * d;
+    den += d * d;
+  }
+  const double acceleration = den > 0.0 ? num / (6.0 * std::pow(den, 1.5)) : 0.0;
+
+  auto adjusted = [&](double level) {
+    const double z = z0 + StandardNormalQuantile(level);
+    const double denominator = 1.0 - acceleration * z;
+    return denominator > 0.0 ? StandardNormalCdf(z0 + z / denominator) : std::numeric_limits<double>::quiet_NaN();
+  };
+  const double lower_level = adjusted(alpha);
+  const double upper_level = adjusted(1.0 - alpha);
+  if (!std::isnan(lower_level) && !std::isnan(upper_level)) {
+    result.bca = {SortedQuantile(replicates, lower_level), SortedQuantile(replicates, upper_level)};
+  }
+  return result;
+}
+
+} // namespace
+
+DistributionExperiment::DistributionExperiment(std::shared_ptr<Distribution> dist, size_t sample_size) :
+    dist_(std::move(dist)),
+    sample_size_(sample_size) {
+  if (!dist_) {
+    throw std::invalid_argument("Distribution must not be null");
+  }
+}
+
+ExperimentStats DistributionExperiment::Run(std::mt19937& rng) {
+  return run(rng, nullptr);
+}
+
+ExperimentStats DistributionExperiment::Run(std::mt19937& rng, QuantileSketch& sketch) {
+  return run(rng, &sketch);
+}
+
+ExperimentStats DistributionExperiment::run(std::mt19937& rng, QuantileSketch* sketch) {
+  PTM_METRICS_TIMER(timer, "distribution_experiment.run");
+  PTM_METRICS_TIMER_ITEMS(timer, sample_size_);
+  PTM_METRICS_COUNT("distribution_experiment.samples", sample_size_);
+
+  // Среднее и дисперсия по Уэлфорду, без хранения выборки
+  double mean = 0.0;
+  double m2 = 0.0;
+  for (size_t i = 1; i <= sample_size_; ++i) {
+    const double x = dist_->Sample(rng);
+    if (sketch != nullptr) {
+      sketch->Add(x);
+    }
+    const double delta = x - mean;
+    mean += delta / static_cast<double>(i);
+    m2 += delta * (x - mean);
+  }
+
+  ExperimentStats stats;
+  stats.empirical_mean = mean;
+  stats.empirical_variance = sample_size_ > 1 ? m2 / static_cast<double>(sample_size_ - 1) : 0.0;
+  stats.mean_error = std::abs(stats.empirical_mean - dist_->TheoreticalMean());
+  stats.variance_error = std::abs(stats.empirical_variance - dist_->TheoreticalVariance());
+  return stats;
+}
+
+std::vector<double> DistributionExperiment::EmpiricalCdf(const std::vector<double>& grid,
+                                                         std::mt19937& rng,
+                                                         std::size_t sample_size) {
+  PTM_METRICS_COUNT("distribution_experiment.samples", sample_size);
+
+  std::vector<double> sample(sample_size);
+  {
+    PTM_METRICS_TIMER(timer, "distribution_experiment.empirical_cdf.sample");
+    PTM_METRICS_TIMER_ITEMS(timer, sample_size);
+    for (double& x : sample) {
+      x = dist_->Sample(rng);
+    }
+  }
+  {
+    PTM_METRICS_TIMER(timer, "distribution_experiment.empirical_cdf.sort");
+    PTM_METRICS_TIMER_ITEMS(timer, sample_size);
+    std::ranges::sort(sample);
+  }
+
+  PTM_METRICS_TIMER(timer, "distribution_experiment.empirical_cdf.evaluate");
+  PTM_METRICS_TIMER_ITEMS(timer, grid.size());
+  std::vector<double> result;
+  result.reserve(grid.size());
+  for (double point : grid) {
+    const auto below = std::ranges::upper_bound(sample, point) - sample.begin();
+    result.push_back(sample_size == 0 ? 0.0 : static_cast<double>(below) / static_cast<double>(sample_size));
+  }
+  return result;
+}
+
+double DistributionExperiment::KolmogorovDistance(const std::vector<double>& grid,
+                                                  const std::vector<double>& empirical_cdf) const {
+  if (grid.size() != empirical_cdf.size()) {
+    throw std::invalid_argument("Grid and empirical CDF must have the same size");
+  }
+  PTM_METRICS_TIMER(timer, "distribution_experiment.kolmogorov_distance");
+  PTM_METRICS_TIMER_ITEMS(timer, grid.size());
+
+  double distance = 0.0;
+  for (size_t i = 0; i < grid.size(); ++i) {
+    distance = std::max(distance, std::abs(empirical_cdf[i] - dist_->Cdf(grid[i])));
+  }
+  return distance;
+}
+
+double DistributionExperiment::KolmogorovDistance(const QuantileSketch& sketch) const {
+  PTM_METRICS_TIMER(timer, "distribution_experiment.kolmogorov_distance");
+  PTM_METRICS_TIMER_ITEMS(timer, sketch.GetRetainedCount());
+
+  double distance = 0.0;
+  for (const auto& [x, cdf] : sketch.GetCdfPoints()) {
+    distance = std::max(distance, std::abs(cdf - dist_->Cdf(x)));
+  }
+  return distance;
+}
+
+BootstrapResult DistributionExperiment::Bootstrap(std::mt19937& rng,
+                                                  std::size_t num_resamples,
+                                                  double confidence,
+                                                  ResamplingScheme scheme,
+                                                  std::size_t num_threads) {
+  if (num_resamples == 0) {
+    throw std::invalid_argument("Number of bootstrap resamples must be positive");
+  }
+  if (!(confidence > 0.0 && confidence < 1.0)) {
+    throw std::invalid_argument("Confidence level must be in (0, 1)");
+  }
+  if (sample_size_ < 2) {
+    throw std::invalid_argument("Bootstrap needs a sample of at least two values");
+  }
+  // Индексы выборки хранятся как uint32
+  if (sample_size_ > std::numeric_limits<std::uint32_t>::max()) {
+    throw std::length_error("Bootstrap sample must not exceed 2^32 - 1 values");
+  }
+  PTM_METRICS_TIMER(timer, "distribution_experiment.bootstrap");
+  PTM_METRICS_TIMER_ITEMS(timer, num_resamples);
+  PTM_METRICS_COUNT("distribution_experiment.samples", sample_size_);
+
+  const std::size_t n = sample_size_;
+  std::vector<double> values(n);
+  for (double& x : values) {
+    x = dist_->Sample(rng);
+  }
+
+  // Сортировка перестановки: группа jackknife остаётся привязанной к порядку выборки
+  std::vector<std::uint32_t> order(n);
+  std::iota(order.begin(), order.end(), 0U);
+  std::ranges::sort(order, {}, [&values](std::uint32_t i) { return values[i]; });
+
+  SortedSample sample;
+  sample.mean = std::accumulate(values.begin(), values.end(), 0.0) / static_cast<double>(n);
+  const std::size_t num_groups = std::min(kJackknifeGroups, n);
+  sample.deviations.resize(n);
+  sample.groups.resize(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    sample.deviations[i] = values[order[i]] - sample.mean;
+    sample.groups[i] = static_cast<std::uint32_t>(order[i] % num_groups);
+    if (i + 1 == n || values[order[i + 1]] != values[order[i]]) {
+      sample.run_ends.push_back(i + 1);
+      sample.run_cdf.push_back(dist_->Cdf(values[order[i]]));
+    }
+  }
+
+  const WeightedStats full = ComputeWeighted(sample, [](std::size_t) { return 1.0; });
+
+  // Зерно каждого повтора зависит только от его номера, так что результат не зависит от числа потоков
+  const std::uint32_t seed_low = rng();
+  const std::uint32_t seed_high = rng();
+  std::vector<WeightedStats> replicates(num_resamples);
+  auto resample = [&](std::size_t b, std::vector<double>& weights) {
+    std::seed_seq seq{seed_low, seed_high, static_cast<std::uint32_t>(b), static_cast<std::uint32_t>(b >> 32)};
+    std::mt19937 gen(seq);
+
+    if (scheme == ResamplingScheme::Multinomial) {
+      weights.assign(n, 0.0);
+      std::uniform_int_distribution<std::size_t> pick(0, n - 1);
+      for (std::size_t k = 0; k < n; ++k) {
+        weights[pick(gen)] += 1.0;
+      }
+    } else {
+      weights.resize(n);
+      std::poisson_distribution<int> poisson(1.0);
+      for (double& w : weights) {
+        w = static_cast<double>(poisson(gen));
+      }
+    }
+    replicates[b] = ComputeWeighted(sample, [&weights](std::size_t i) { return weights[i]; });
+  };
+  const std::size_t num_chunks = ResolveThreadCount(num_threads, num_resamples);
+  ParallelFor(num_resamples, num_chunks, num_threads, [&](std::size_t /*chunk*/, std::size_t begin, std::size_t end) {
+    std::vector<double> weights;
+    for (std::size_t b = begin; b < end; ++b) {
+      resample(b, weights);
+    }
+  });
+
+  // Сгруппированный jackknife: выбрасывается целая группа
+  std::vector<WeightedStats> jackknife(num_groups);
+  ParallelFor(num_groups, num_groups, num_threads, [&](std::size_t g, std::size_t /*begin*/, std::size_t /*end*/) {
+    jackknife[g] = ComputeWeighted(sample, [&sample, g](std::size_t i) { return sample.groups[i] == g ? 0.0 : 1.0; });
+  });
+
+  auto summarize = [&](double WeightedStats::*field) {
+    std::vector<double> boot(num_resamples);
+    std::ranges::transform(replicates, boot.begin(), [field](const WeightedStats& s) { return s.*field; });
+    std::vector<double> jack(num_groups);
+    std::ranges::transform(jackknife, jack.begin(), [field](const WeightedStats& s) { return s.*field; });
+    return Summarize(full.*field, std::move(boot), jack, confidence);
+  };
+
+  BootstrapResult result;
+  result.num_resamples = num_resamples;
+  result.confidence = confidence;
+  result.mean = summarize(&WeightedStats::mean);
+  result.variance = summarize(&WeightedStats::variance);
+  result.kolmogorov_distance = summarize(&WeightedStats::kolmogorov_distance);
+  return result;
+}
+
+} // namespace ptm
@@ -3,9 +3,12 @@
 
 #include <memory>
 #include <random>
+#include <vector>
 
+#include "BootstrapResult.hpp"
 #include "Distribution.hpp"
 #include "ExperimentStats.hpp"
+#include "QuantileSketch.hpp"
 
 namespace ptm {
 
@@ -15,6 +18,9 @@ public:
   DistributionExperiment(std::shared_ptr<Distribution> dist, size_t sample_size);
 
   ExperimentStats Run(std::mt19937& rng);
+  // То же, каждое значение дополнительно попадает в скетч. Для нескольких потоков - свой скетч
+  // с отдельным seed и свой генератор на поток, затем QuantileSketch::Merge
+  ExperimentStats Run(std::mt19937& rng, QuantileSketch& sketch);
 
   // Эмпирическая CDF на сетке точек
   std::vector<double> EmpiricalCdf(const std::vector<double>& grid, std::mt19937& rng, std::size_t sample_size);
@@ -22,10 +28,23 @@ public:
   // Оценка статистики Колмогорова между эмпирической и теоретической CDF
   [[nodiscard]] double KolmogorovDistance(const std::vector<double>& grid,
                                           const std::vector<double>& empirical_cdf) const;
+  // То же по скетчу, в хранимых им значениях. Отличается от точного не больше чем на RankErrorBound()
+  [[nodiscard]] double KolmogorovDistance(const QuantileSketch& sketch) const;
+
+  // Одна выборка размера sample_size и num_resamples перевзвешиваний без копирования значений.
+  // Интервалы для среднего, дисперсии и расстояния Колмогорова; num_threads = 0 - по числу ядер
+  // std::length_error, если sample_size больше 2^32 - 1
+  BootstrapResult Bootstrap(std::mt19937& rng,
+                            std::size_t num_resamples,
+                            double confidence = 0.95,
+                            ResamplingScheme scheme = ResamplingScheme::Multinomial,
+                            std::size_t num_threads = 0);
 
 private:
   std::shared_ptr<Distribution> dist_;
   std::size_t sample_size_;
+
+  ExperimentStats run(std::mt19937& rng, QuantileSketch* sketch);
 };
 
 } // namespace ptm
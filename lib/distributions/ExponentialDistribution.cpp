@@ -1 +1,39 @@
 #include "ExponentialDistribution.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace ptm {
+
+ExponentialDistribution::ExponentialDistribution(double lambda) : lambda_(lambda) {
+  if (!(lambda > 0.0)) {
+    throw std::invalid_argument("Exponential distribution requires lambda > 0");
+  }
+}
+
+double ExponentialDistribution::Pdf(double x) const {
+  return x < 0.0 ? 0.0 : lambda_ * std::exp(-lambda_ * x);
+}
+
+double ExponentialDistribution::Cdf(double x) const {
+  return x <= 0.0 ? 0.0 : -std::expm1(-lambda_ * x);
+}
+
+double ExponentialDistribution::Quantile(double u) const {
+  checkQuantileLevel(u);
+  return -std::log1p(-u) / lambda_;
+}
+
+double ExponentialDistribution::Sample(std::mt19937& rng) const {
+  return std::exponential_distribution<double>(lambda_)(rng);
+}
+
+double ExponentialDistribution::TheoreticalMean() const {
+  return 1.0 / lambda_;
+}
+
+double ExponentialDistribution::TheoreticalVariance() const {
+  return 1.0 / (lambda_ * lambda_);
+}
+
+} // namespace ptm
@@ -11,6 +11,7 @@ public:
 
   [[nodiscard]] double Pdf(double x) const override;
   [[nodiscard]] double Cdf(double x) const override;
+  [[nodiscard]] double Quantile(double u) const override;
   double Sample(std::mt19937& rng) const override;
 
   [[nodiscard]] double TheoreticalMean() const override;
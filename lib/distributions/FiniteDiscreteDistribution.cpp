@@ -0,0 +1,136 @@
+#include "FiniteDiscreteDistribution.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
+namespace ptm {
+
+FiniteDiscreteDistribution::FiniteDiscreteDistribution(const std::vector<double>& values,
+                                                       const std::vector<double>& probabilities) {
+  if (values.size() != probabilities.size()) {
+    throw std::invalid_argument("Values and probabilities must have the same size");
+  }
+
+  std::vector<size_t> order(values.size());
+  std::iota(order.begin(), order.end(), size_t{0});
+  std::ranges::sort(order, {}, [&values](size_t i) { return values[i]; });
+
+  // Сортировка и склейка равных значений; значения с нулевой вероятностью в носитель не входят
+  double total = 0.0;
+  for (size_t i : order) {
+    const double p = probabilities[i];
+    if (p < 0.0 || !std::isfinite(p)) {
+      throw std::invalid_argument("Probabilities must be finite and non-negative");
+    }
+    if (p == 0.0) {
+      continue;
+    }
+    if (!values_.empty() && values_.back() == values[i]) {
+      probs_.back() += p;
+    } else {
+      values_.push_back(values[i]);
+      probs_.push_back(p);
+    }
+    total += p;
+  }
+  if (total <= 0.0) {
+    throw std::invalid_argument("Total probability must be positive");
+  }
+
+  cdf_.resize(probs_.size());
+  double running = 0.0;
+  for (size_t i = 0; i < probs_.size(); ++i) {
+    probs_[i] /= total;
+    running += probs_[i];
+    cdf_[i] = running;
+    mean_ += probs_[i] * values_[i];
+  }
+  cdf_.back() = 1.0;
+
+  for (size_t i = 0; i < probs_.size(); ++i) {
+    const double d = values_[i] - mean_;
+    variance_ += probs_[i] * d * d;
+  }
+
+  buildAliasTable();
+}
+
+void FiniteDiscreteDistribution::buildAliasTable() {
+  // Метод Vose: ячейки с массой меньше средней добираются из ячеек с большей
+  const size_t n = probs_.size();
+  alias_threshold_.assign(n, 1.0);
+  alias_index_.resize(n);
+  std::iota(alias_index_.begin(), alias_index_.end(), size_t{0});
+
+  std::vector<double> scaled(n);
+  std::vector<size_t> small;
+  std::vector<size_t> large;
+  for (size_t i = 0; i < n; ++i) {
+    scaled[i] = probs_[i] * static_cast<double>(n);
+    (scaled[i] < 1.0 ? small : large).push_back(i);
+  }
+
+  while (!small.empty() && !large.empty()) {
+    size_t s = small.back();
+    small.pop_back();
+    size_t l = large.back();
+
+    alias_threshold_[s] = scaled[s];
+    alias_index_[s] = l;
+    scaled[l] -= 1.0 - scaled[s];
+    if (scaled[l] < 1.0) {
+      large.pop_back();
+      small.push_back(l);
+    }
+  }
+}
+
+double FiniteDiscreteDistribution::Pdf(double x) const {
+  auto it = std::ranges::lower_bound(values_, x);
+  if (it == values_.end() || *it != x) {
+    return 0.0;
+  }
+  return probs_[static_cast<size_t>(it - values_.begin())];
+}
+
+double FiniteDiscreteDistribution::Cdf(double x) const {
+  auto it = std::ranges::upper_bound(values_, x);
+  if (it == values_.begin()) {
+    return 0.0;
+  }
+  return cdf_[static_cast<size_t>(it - values_.begin()) - 1];
+}
+
+double FiniteDiscreteDistribution::Quantile(double u) const {
+  checkQuantileLevel(u);
+  auto it = std::ranges::lower_bound(cdf_, u);
+  return it == cdf_.end() ? values_.back() : values_[static_cast<std::size_t>(it - cdf_.begin())];
+}
+
+double FiniteDiscreteDistribution::Sample(std::mt19937& rng) const {
+  const auto n = static_cast<double>(values_.size());
+  const double u = std::uniform_real_distribution<double>(0.0, n)(rng);
+  const auto column = std::min(static_cast<size_t>(u), values_.size() - 1);
+  const double fraction = u - static_cast<double>(column);
+  return values_[fraction < alias_threshold_[column] ? column : alias_index_[column]];
+}
+
+double FiniteDiscreteDistribution::TheoreticalMean() const {
+  return mean_;
+}
+
+double FiniteDiscreteDistribution::TheoreticalVariance() const {
+  return variance_;
+}
+
+const std::vector<double>& FiniteDiscreteDistribution::GetValues() const noexcept {
+  return values_;
+}
+
+const std::vector<double>& FiniteDiscreteDistribution::GetProbabilities() const noexcept {
+  return probs_;
+}
+
+} // namespace ptm
@@ -0,0 +1,47 @@
+#ifndef PTM_FINITEDISCRETEDISTRIBUTION_HPP_
+#define PTM_FINITEDISCRETEDISTRIBUTION_HPP_
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "Distribution.hpp"
+
+namespace ptm {
+
+// Распределение на конечном наборе значений, заданное таблицей value -> prob.
+// Значения могут идти в любом порядке и повторяться, вероятности нормируются.
+// Cdf - бинарный поиск по префиксным суммам, Sample - alias-метод Уокера за O(1)
+class FiniteDiscreteDistribution : public Distribution {
+public:
+  FiniteDiscreteDistribution(const std::vector<double>& values, const std::vector<double>& probabilities);
+
+  [[nodiscard]] double Pdf(double x) const override;
+  [[nodiscard]] double Cdf(double x) const override;
+  [[nodiscard]] double Quantile(double u) const override;
+  double Sample(std::mt19937& rng) const override;
+
+  [[nodiscard]] double TheoreticalMean() const override;
+  [[nodiscard]] double TheoreticalVariance() const override;
+
+  // Носитель по возрастанию и соответствующие вероятности
+  [[nodiscard]] const std::vector<double>& GetValues() const noexcept;
+  [[nodiscard]] const std::vector<double>& GetProbabilities() const noexcept;
+
+private:
+  std::vector<double> values_;
+  std::vector<double> probs_;
+  std::vector<double> cdf_;
+
+  std::vector<double> alias_threshold_;
+  std::vector<std::size_t> alias_index_;
+
+  double mean_ = 0.0;
+  double variance_ = 0.0;
+
+  void buildAliasTable();
+};
+
+} // namespace ptm
+
+#endif // PTM_FINITEDISCRETEDISTRIBUTION_HPP_
@@ -1 +1,55 @@
 #include "GeometricDistribution.hpp"
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace ptm {
+
+GeometricDistribution::GeometricDistribution(double p) : p_(p), log_q_(std::log1p(-p)) {
+  if (!(p > 0.0 && p <= 1.0)) {
+    throw std::invalid_argument("Geometric distribution requires 0 < p <= 1");
+  }
+}
+
+double GeometricDistribution::Pdf(double x) const {
+  if (x < 1.0 || std::floor(x) != x) {
+    return 0.0;
+  }
+  return std::pow(1.0 - p_, x - 1.0) * p_;
+}
+
+double GeometricDistribution::Cdf(double x) const {
+  if (x < 1.0) {
+    return 0.0;
+  }
+  return 1.0 - std::pow(1.0 - p_, std::floor(x));
+}
+
+double GeometricDistribution::Quantile(double u) const {
+  checkQuantileLevel(u);
+  if (u == 1.0 && p_ < 1.0) {
+    return std::numeric_limits<double>::infinity();
+  }
+  if (p_ == 1.0) {
+    return 1.0;
+  }
+  // 1 - (1 - p)^k >= u; поправка на округление по Cdf
+  const double guess = std::ceil(std::log1p(-u) / log_q_);
+  return discreteQuantile(u, guess, 1.0, std::numeric_limits<double>::max());
+}
+
+double GeometricDistribution::Sample(std::mt19937& rng) const {
+  // std::geometric_distribution считает неудачи до первого успеха, т.е. живёт на {0, 1, ...}
+  return static_cast<double>(std::geometric_distribution<long long>(p_)(rng)) + 1.0;
+}
+
+double GeometricDistribution::TheoreticalMean() const {
+  return 1.0 / p_;
+}
+
+double GeometricDistribution::TheoreticalVariance() const {
+  return (1.0 - p_) / (p_ * p_);
+}
+
+} // namespace ptm
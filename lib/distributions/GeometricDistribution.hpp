@@ -14,6 +14,7 @@ public:
 
   [[nodiscard]] double Pdf(double x) const override;
   [[nodiscard]] double Cdf(double x) const override;
+  [[nodiscard]] double Quantile(double u) const override;
   double Sample(std::mt19937& rng) const override;
 
   [[nodiscard]] double TheoreticalMean() const override;
@@ -21,6 +22,8 @@ public:
 
 private:
   double p_;
+  // log(1 - p) для начального приближения Quantile
+  double log_q_;
 };
 
 } // namespace ptm
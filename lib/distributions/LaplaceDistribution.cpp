@@ -1 +1,47 @@
 #include "LaplaceDistribution.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace ptm {
+
+LaplaceDistribution::LaplaceDistribution(double mu, double b) : mu_(mu), b_(b) {
+  if (!(b > 0.0)) {
+    throw std::invalid_argument("Laplace distribution requires b > 0");
+  }
+}
+
+double LaplaceDistribution::Pdf(double x) const {
+  return std::exp(-std::abs(x - mu_) / b_) / (2.0 * b_);
+}
+
+double LaplaceDistribution::Cdf(double x) const {
+  if (x < mu_) {
+    return 0.5 * std::exp((x - mu_) / b_);
+  }
+  return 1.0 - 0.5 * std::exp(-(x - mu_) / b_);
+}
+
+double LaplaceDistribution::Quantile(double u) const {
+  checkQuantileLevel(u);
+  if (u < 0.5) {
+    return mu_ + b_ * std::log(2.0 * u);
+  }
+  return mu_ - b_ * std::log(2.0 * (1.0 - u));
+}
+
+double LaplaceDistribution::Sample(std::mt19937& rng) const {
+  // Обратная функция распределения от u ~ U(-1/2, 1/2)
+  const double u = std::uniform_real_distribution<double>(-0.5, 0.5)(rng);
+  return mu_ - b_ * std::copysign(1.0, u) * std::log1p(-2.0 * std::abs(u));
+}
+
+double LaplaceDistribution::TheoreticalMean() const {
+  return mu_;
+}
+
+double LaplaceDistribution::TheoreticalVariance() const {
+  return 2.0 * b_ * b_;
+}
+
+} // namespace ptm
@@ -1 +1,52 @@
 #include "NormalDistribution.hpp"
+
+#include <cmath>
+#include <numbers>
+#include <stdexcept>
+
+#include "SpecialFunctions.hpp"
+
+namespace ptm {
+
+NormalDistribution::NormalDistribution(double mean, double stddev) : mean_(mean), stddev_(stddev) {
+  if (!(stddev > 0.0)) {
+    throw std::invalid_argument("Normal distribution requires stddev > 0");
+  }
+}
+
+double NormalDistribution::Pdf(double x) const {
+  const double z = (x - mean_) / stddev_;
+  return std::exp(-0.5 * z * z) / (stddev_ * std::sqrt(2.0 * std::numbers::pi));
+}
+
+double NormalDistribution::Cdf(double x) const {
+  const double z = (x - mean_) / stddev_;
+  return 0.5 * std::erfc(-z / std::numbers::sqrt2);
+}
+
+double NormalDistribution::Quantile(double u) const {
+  checkQuantileLevel(u);
+  return mean_ + stddev_ * StandardNormalQuantile(u);
+}
+
+double NormalDistribution::Sample(std::mt19937& rng) const {
+  return std::normal_distribution<double>(mean_, stddev_)(rng);
+}
+
+double NormalDistribution::TheoreticalMean() const {
+  return mean_;
+}
+
+double NormalDistribution::TheoreticalVariance() const {
+  return stddev_ * stddev_;
+}
+
+double NormalDistribution::GetMean() const {
+  return mean_;
+}
+
+double NormalDistribution::GetStddev() const {
+  return stddev_;
+}
+
+} // namespace ptm
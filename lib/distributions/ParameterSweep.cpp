@@ -0,0 +1,121 @@
+#include "ParameterSweep.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+#include "metrics/Metrics.hpp"
+#include "parallel/ParallelFor.hpp"
+
+namespace ptm {
+
+namespace {
+
+// 8192 double = 64 КиБ: блок u и блок X одной точки помещаются в L2
+constexpr std::size_t kBlockSize = 8192;
+
+// Блок равномерных чисел из (0, 1) с 53 значащими битами. Генератор блока зависит только
+// от зерна прогона и номера блока, поэтому потоки строят одинаковые блоки независимо
+void FillUniformBlock(std::uint32_t seed_low, std::uint32_t seed_high, std::size_t block, std::vector<double>& u) {
+  std::seed_seq seq{seed_low, seed_high, static_cast<std::uint32_t>(block), static_cast<std::uint32_t>(block >> 32)};
+  std::mt19937 gen(seq);
+  for (double& x : u) {
+    const std::uint32_t a = gen() >> 5;
+    const std::uint32_t b = gen() >> 6;
+    x = (static_cast<double>(a) * 67108864.0 + static_cast<double>(b) + 0.5) / 9007199254740992.0;
+  }
+}
+
+// Среднее и сумма квадратов отклонений, объединяемые по Чану
+struct RunningMoments {
+  double count = 0.0;
+  double mean = 0.0;
+  double m2 = 0.0;
+
+  void MergeBlock(const double* x, std::size_t n) {
+    double sum = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+      sum += x[i];
+    }
+    const double block_mean = sum / static_cast<double>(n);
+    double block_m2 = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+      block_m2 += (x[i] - block_mean) * (x[i] - block_mean);
+    }
+
+    const auto block_count = static_cast<double>(n);
+    const double total = count + block_count;
+    const double delta = block_mean - mean;
+    mean += delta * block_count / total;
+    m2 += block_m2 + delta * delta * count * block_count / total;
+    count = total;
+  }
+};
+
+} // namespace
+
+ParameterSweep::ParameterSweep(std::vector<std::shared_ptr<Distribution>> grid, std::size_t sample_size) :
+    grid_(std::move(grid)),
+    sample_size_(sample_size) {
+  if (std::ranges::any_of(grid_, [](const auto& dist) { return !dist; })) {
+    throw std::invalid_argument("Distribution must not be null");
+  }
+  if (sample_size_ == 0) {
+    throw std::invalid_argument("Sample size must be positive");
+  }
+}
+
+std::size_t ParameterSweep::GetGridSize() const noexcept {
+  return grid_.size();
+}
+
+std::vector<ExperimentStats> ParameterSweep::Run(std::mt19937& rng, std::size_t num_threads) const {
+  PTM_METRICS_TIMER(timer, "parameter_sweep.run");
+  PTM_METRICS_TIMER_ITEMS(timer, grid_.size() * sample_size_);
+
+  std::vector<ExperimentStats> result(grid_.size());
+  if (grid_.empty()) {
+    return result;
+  }
+  num_threads = ResolveThreadCount(num_threads, grid_.size());
+
+  const std::uint32_t seed_low = rng();
+  const std::uint32_t seed_high = rng();
+  const std::size_t num_blocks = (sample_size_ + kBlockSize - 1) / kBlockSize;
+
+  // Каждый поток сам строит блоки u (работа ГСЧ ~ число потоков, а не размер сетки)
+  // и прогоняет их через свой кусок сетки
+  auto worker = [&](std::size_t begin, std::size_t end) {
+    std::vector<RunningMoments> moments(end - begin);
+    std::vector<double> u(kBlockSize);
+    std::vector<double> x(kBlockSize);
+    for (std::size_t block = 0; block < num_blocks; ++block) {
+      const std::size_t n = std::min(kBlockSize, sample_size_ - block * kBlockSize);
+      u.resize(n);
+      FillUniformBlock(seed_low, seed_high, block, u);
+      for (std::size_t g = begin; g < end; ++g) {
+        const Distribution& dist = *grid_[g];
+        for (std::size_t i = 0; i < n; ++i) {
+          x[i] = dist.Quantile(u[i]);
+        }
+        moments[g - begin].MergeBlock(x.data(), n);
+      }
+    }
+
+    for (std::size_t g = begin; g < end; ++g) {
+      const RunningMoments& m = moments[g - begin];
+      ExperimentStats& stats = result[g];
+      stats.empirical_mean = m.mean;
+      stats.empirical_variance = m.count > 1.0 ? m.m2 / (m.count - 1.0) : 0.0;
+      stats.mean_error = std::abs(stats.empirical_mean - grid_[g]->TheoreticalMean());
+      stats.variance_error = std::abs(stats.empirical_variance - grid_[g]->TheoreticalVariance());
+    }
+  };
+
+  ParallelFor(grid_.size(), num_threads, num_threads,
+              [&worker](std::size_t /*chunk*/, std::size_t begin, std::size_t end) { worker(begin, end); });
+  return result;
+}
+
+} // namespace ptm
@@ -0,0 +1,47 @@
+#ifndef PTM_PARAMETERSWEEP_HPP_
+#define PTM_PARAMETERSWEEP_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "Distribution.hpp"
+#include "ExperimentStats.hpp"
+
+namespace ptm {
+
+// Эксперимент по сетке параметров на общих случайных числах: поток равномерных u_i
+// генерируется блоками один раз, и каждая точка сетки получает X_i = Quantile(u_i).
+// Разности между точками сетки не зашумлены независимыми выборками
+class ParameterSweep {
+public:
+  // std::invalid_argument для пустого распределения в сетке и sample_size == 0
+  ParameterSweep(std::vector<std::shared_ptr<Distribution>> grid, std::size_t sample_size);
+
+  // Сетка из значений параметра: make(parameter) -> std::shared_ptr<Distribution>
+  template <typename Factory>
+  static ParameterSweep Over(const std::vector<double>& parameters, Factory&& make, std::size_t sample_size) {
+    std::vector<std::shared_ptr<Distribution>> grid;
+    grid.reserve(parameters.size());
+    for (double parameter : parameters) {
+      grid.push_back(make(parameter));
+    }
+    return {std::move(grid), sample_size};
+  }
+
+  // Статистики для каждой точки сетки в её порядке. Точки раздаются потокам кусками,
+  // блок равномерных чисел остаётся в кэше, пока его проходят все точки куска.
+  // Результат не зависит от num_threads; 0 - по числу ядер
+  [[nodiscard]] std::vector<ExperimentStats> Run(std::mt19937& rng, std::size_t num_threads = 0) const;
+
+  [[nodiscard]] std::size_t GetGridSize() const noexcept;
+
+private:
+  std::vector<std::shared_ptr<Distribution>> grid_;
+  std::size_t sample_size_;
+};
+
+} // namespace ptm
+
+#endif // PTM_PARAMETERSWEEP_HPP_
@@ -1 +1,62 @@
 #include "PoissonDistribution.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "SpecialFunctions.hpp"
+
+namespace ptm {
+
+PoissonDistribution::PoissonDistribution(double lambda) : lambda_(lambda) {
+  if (!(lambda > 0.0)) {
+    throw std::invalid_argument("Poisson distribution requires lambda > 0");
+  }
+  const double mode = std::floor(lambda_);
+  table_ = DiscreteQuantileTable::Around(
+      mode, PoissonDistribution::Pdf(mode), 0.0, 0x1p53, [this](double k) { return lambda_ / (k + 1.0); },
+      [this](double k) { return PoissonDistribution::Cdf(k); });
+}
+
+double PoissonDistribution::Pdf(double x) const {
+  if (x < 0.0 || std::floor(x) != x || x >= 0x1p63) {
+    return 0.0;
+  }
+  return PoissonPmf(static_cast<std::uint64_t>(x), lambda_);
+}
+
+double PoissonDistribution::Cdf(double x) const {
+  if (x < 0.0) {
+    return 0.0;
+  }
+
+  // P(X <= k) = Q(k + 1, λ)
+  return RegularizedGammaQ(std::floor(x) + 1.0, lambda_);
+}
+
+double PoissonDistribution::Quantile(double u) const {
+  checkQuantileLevel(u);
+  if (u == 1.0) {
+    return std::numeric_limits<double>::infinity();
+  }
+  if (const auto k = table_.Find(u)) {
+    return *k;
+  }
+  const double guess = lambda_ + std::sqrt(lambda_) * StandardNormalQuantile(std::max(u, 1e-300));
+  return discreteQuantile(u, guess, 0.0, 0x1p53);
+}
+
+double PoissonDistribution::Sample(std::mt19937& rng) const {
+  return static_cast<double>(std::poisson_distribution<long long>(lambda_)(rng));
+}
+
+double PoissonDistribution::TheoreticalMean() const {
+  return lambda_;
+}
+
+double PoissonDistribution::TheoreticalVariance() const {
+  return lambda_;
+}
+
+} // namespace ptm
@@ -3,6 +3,7 @@
 
 #include <random>
 
+#include "DiscreteQuantileTable.hpp"
 #include "Distribution.hpp"
 
 namespace ptm {
@@ -14,6 +15,7 @@ public:
 
   [[nodiscard]] double Pdf(double x) const override;
   [[nodiscard]] double Cdf(double x) const override;
+  [[nodiscard]] double Quantile(double u) const override;
   double Sample(std::mt19937& rng) const override;
 
   [[nodiscard]] double TheoreticalMean() const override;
@@ -21,6 +23,8 @@ public:
 
 private:
   double lambda_;
+  // Quantile по таблице F на основной части носителя, точный поиск по Cdf в хвостах
+  DiscreteQuantileTable table_;
 };
 
 } // namespace ptm
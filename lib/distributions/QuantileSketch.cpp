@@ -0,0 +1,196 @@
+#include "QuantileSketch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace ptm {
+
+namespace {
+
+// Ёмкость уровня убывает геометрически от верхнего к нижнему
+constexpr double kCapacityRatio = 2.0 / 3.0;
+constexpr std::size_t kMinLevelCapacity = 2;
+
+} // namespace
+
+QuantileSketch::QuantileSketch(std::size_t k, std::uint64_t seed) : k_(k), coin_state_(seed), levels_(1) {
+  if (k_ < kMinLevelCapacity) {
+    throw std::invalid_argument("Sketch parameter k must be at least 2");
+  }
+  updateCapacity();
+}
+
+std::size_t QuantileSketch::levelCapacity(std::size_t level) const noexcept {
+  const auto depth = static_cast<double>(levels_.size() - 1 - level);
+  const auto capacity = static_cast<std::size_t>(std::ceil(static_cast<double>(k_) * std::pow(kCapacityRatio, depth)));
+  return std::max(capacity, kMinLevelCapacity);
+}
+
+void QuantileSketch::updateCapacity() noexcept {
+  total_capacity_ = 0;
+  for (std::size_t h = 0; h < levels_.size(); ++h) {
+    total_capacity_ += levelCapacity(h);
+  }
+}
+
+bool QuantileSketch::flipCoin() noexcept {
+  // splitmix64
+  std::uint64_t x = (coin_state_ += 0x9E3779B97F4A7C15ULL);
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+  return ((x ^ (x >> 31)) & 1U) != 0;
+}
+
+void QuantileSketch::compactLevel(std::size_t level) {
+  if (level + 1 == levels_.size()) {
+    levels_.emplace_back();
+    updateCapacity();
+  }
+  std::vector<double>& items = levels_[level];
+  std::ranges::sort(items);
+
+  // При нечётном размере наибольшее значение остаётся на уровне
+  const std::size_t paired = items.size() & ~std::size_t{1};
+  std::vector<double>& next = levels_[level + 1];
+  for (std::size_t i = flipCoin() ? 1 : 0; i < paired; i += 2) {
+    next.push_back(items[i]);
+  }
+  items.erase(items.begin(), items.begin() + static_cast<std::ptrdiff_t>(paired));
+  retained_ -= paired / 2;
+}
+
+void QuantileSketch::compress() {
+  while (retained_ >= total_capacity_) {
+    for (std::size_t h = 0; h < levels_.size(); ++h) {
+      if (levels_[h].size() >= levelCapacity(h)) {
+        compactLevel(h);
+        break;
+      }
+    }
+  }
+}
+
+void QuantileSketch::Add(double x) {
+  if (count_ == 0) {
+    min_ = x;
+    max_ = x;
+  } else {
+    min_ = std::min(min_, x);
+    max_ = std::max(max_, x);
+  }
+  ++count_;
+  levels_[0].push_back(x);
+  ++retained_;
+  if (retained_ >= total_capacity_) {
+    compress();
+  }
+}
+
+void QuantileSketch::Merge(const QuantileSketch& other) {
+  if (other.k_ != k_) {
+    throw std::invalid_argument("Sketches with different k cannot be merged");
+  }
+  if (other.count_ == 0) {
+    return;
+  }
+
+  min_ = count_ == 0 ? other.min_ : std::min(min_, other.min_);
+  max_ = count_ == 0 ? other.max_ : std::max(max_, other.max_);
+  count_ += other.count_;
+  if (levels_.size() < other.levels_.size()) {
+    levels_.resize(other.levels_.size());
+    updateCapacity();
+  }
+  for (std::size_t h = 0; h < other.levels_.size(); ++h) {
+    levels_[h].insert(levels_[h].end(), other.levels_[h].begin(), other.levels_[h].end());
+  }
+  retained_ += other.retained_;
+  compress();
+}
+
+std::uint64_t QuantileSketch::GetCount() const noexcept {
+  return count_;
+}
+
+bool QuantileSketch::IsEmpty() const noexcept {
+  return count_ == 0;
+}
+
+double QuantileSketch::GetMin() const noexcept {
+  return count_ == 0 ? std::numeric_limits<double>::quiet_NaN() : min_;
+}
+
+double QuantileSketch::GetMax() const noexcept {
+  return count_ == 0 ? std::numeric_limits<double>::quiet_NaN() : max_;
+}
+
+std::size_t QuantileSketch::GetK() const noexcept {
+  return k_;
+}
+
+std::size_t QuantileSketch::GetRetainedCount() const noexcept {
+  return retained_;
+}
+
+double QuantileSketch::Cdf(double x) const {
+  if (count_ == 0) {
+    return 0.0;
+  }
+  std::uint64_t below = 0;
+  for (std::size_t h = 0; h < levels_.size(); ++h) {
+    const auto n = static_cast<std::uint64_t>(std::ranges::count_if(levels_[h], [x](double v) { return v <= x; }));
+    below += n << h;
+  }
+  return std::min(1.0, static_cast<double>(below) / static_cast<double>(count_));
+}
+
+std::vector<std::pair<double, double>> QuantileSketch::GetCdfPoints() const {
+  std::vector<std::pair<double, std::uint64_t>> weighted;
+  weighted.reserve(retained_);
+  for (std::size_t h = 0; h < levels_.size(); ++h) {
+    for (double v : levels_[h]) {
+      weighted.emplace_back(v, std::uint64_t{1} << h);
+    }
+  }
+  std::ranges::sort(weighted);
+
+  std::vector<std::pair<double, double>> points;
+  std::uint64_t cumulative = 0;
+  for (std::size_t i = 0; i < weighted.size(); ++i) {
+    cumulative += weighted[i].second;
+    if (i + 1 == weighted.size() || weighted[i + 1].first != weighted[i].first) {
+      points.emplace_back(weighted[i].first,
+                          std::min(1.0, static_cast<double>(cumulative) / static_cast<double>(count_)));
+    }
+  }
+  return points;
+}
+
+double QuantileSketch::Quantile(double q) const {
+  if (!(q >= 0.0 && q <= 1.0)) {
+    throw std::invalid_argument("Quantile level must be in [0, 1]");
+  }
+  if (count_ == 0) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+  // Крайние значения могли уйти при уплотнении, но хранятся отдельно
+  if (q == 0.0) {
+    return min_;
+  }
+  if (q == 1.0) {
+    return max_;
+  }
+
+  std::vector<std::pair<double, double>> points = GetCdfPoints();
+  auto it = std::ranges::lower_bound(points, q, {}, &std::pair<double, double>::second);
+  return it == points.end() ? max_ : it->first;
+}
+
+double QuantileSketch::RankErrorBound() const noexcept {
+  // Эмпирическая оценка для KLL из Apache DataSketches для одиночного запроса
+  return 2.296 / std::pow(static_cast<double>(k_), 0.9723);
+}
+
+} // namespace ptm
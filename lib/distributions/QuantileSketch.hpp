@@ -0,0 +1,67 @@
+#ifndef PTM_QUANTILESKETCH_HPP_
+#define PTM_QUANTILESKETCH_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace ptm {
+
+// Потоковый скетч квантилей KLL: память O(k) при любом числе значений.
+// Скетчи, заполненные в разных потоках, объединяются через Merge
+class QuantileSketch {
+public:
+  static constexpr std::size_t kDefaultK = 200;
+
+  // Больше k - точнее и больше памяти; seed задаёт монетку при уплотнении. Значения по умолчанию
+  // у seed нет: скетчи, которые потом сливаются, должны получить разные зёрна
+  QuantileSketch(std::size_t k, std::uint64_t seed);
+
+  void Add(double x);
+  // Скетчи должны иметь одинаковое k, иначе std::invalid_argument. RankErrorBound результата
+  // выполняется, только если скетчи заполнялись с разными seed: при общем зерне монетки
+  // уплотнения совпадают и ошибки скетчей складываются, а не гасят друг друга
+  void Merge(const QuantileSketch& other);
+
+  [[nodiscard]] std::uint64_t GetCount() const noexcept;
+  [[nodiscard]] bool IsEmpty() const noexcept;
+  [[nodiscard]] double GetMin() const noexcept;
+  [[nodiscard]] double GetMax() const noexcept;
+  [[nodiscard]] std::size_t GetK() const noexcept;
+  // Сколько значений хранится сейчас
+  [[nodiscard]] std::size_t GetRetainedCount() const noexcept;
+
+  // Доля значений <= x
+  [[nodiscard]] double Cdf(double x) const;
+  // Наименьшее хранимое значение с Cdf >= q, для q = 0 и 1 - точные минимум и максимум; NaN для пустого скетча
+  [[nodiscard]] double Quantile(double q) const;
+
+  // Граница ошибки ранга (в долях от числа значений), выполняется с вероятностью 99%
+  [[nodiscard]] double RankErrorBound() const noexcept;
+
+  // Различные хранимые значения по возрастанию и Cdf в них
+  [[nodiscard]] std::vector<std::pair<double, double>> GetCdfPoints() const;
+
+private:
+  std::size_t k_;
+  std::uint64_t coin_state_;
+  std::uint64_t count_ = 0;
+  double min_ = 0.0;
+  double max_ = 0.0;
+  // levels_[h] - значения с весом 2^h
+  std::vector<std::vector<double>> levels_;
+  std::size_t retained_ = 0;
+  // Сумма ёмкостей уровней; меняется только при появлении нового уровня
+  std::size_t total_capacity_ = 0;
+
+  [[nodiscard]] std::size_t levelCapacity(std::size_t level) const noexcept;
+  void updateCapacity() noexcept;
+  void compress();
+  void compactLevel(std::size_t level);
+  bool flipCoin() noexcept;
+};
+
+} // namespace ptm
+
+#endif // PTM_QUANTILESKETCH_HPP_
@@ -0,0 +1,298 @@
+#include "SpecialFunctions.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numbers>
+#include <stdexcept>
+
+namespace ptm {
+
+namespace {
+
+const double kLogSqrt2Pi = 0.5 * std::log(2.0 * std::numbers::pi);
+// Ниже этого z ряд Стирлинга недостаточно точен
+constexpr double kStirlingSeriesMin = 15.0;
+constexpr double kTiny = 1e-300;
+constexpr double kEpsilon = 1e-15;
+
+double StirlingSeries(double z) {
+  const double inv = 1.0 / z;
+  const double inv2 = inv * inv;
+  return inv * (1.0 / 12.0 - inv2 * (1.0 / 360.0 - inv2 * (1.0 / 1260.0 - inv2 * (1.0 / 1680.0))));
+}
+
+const std::array<double, kLogFactorialTableSize>& LogFactorialTable() {
+  static const std::array<double, kLogFactorialTableSize> table = [] {
+    std::array<double, kLogFactorialTableSize> result{};
+    for (std::size_t n = 1; n < result.size(); ++n) {
+      const auto z = static_cast<double>(n);
+      result[n] = z < kStirlingSeriesMin ? result[n - 1] + std::log(z)
+                                         : (z + 0.5) * std::log(z) - z + kLogSqrt2Pi + StirlingSeries(z);
+    }
+    return result;
+  }();
+  return table;
+}
+
+// Предел числа итераций цепных дробей: им нужно O(√max(a, b)) шагов
+int MaxIterations(double a, double b) {
+  return 200 + static_cast<int>(50.0 * std::sqrt(std::max(a, b)));
+}
+
+// x^a (1 - x)^b / B(a, b) через StirlingError и BinomialDeviance
+double BetaPowerTerm(double a, double b, double x) {
+  const double y = 1.0 - x;
+  if (x == 0.0 || y == 0.0) {
+    return 0.0;
+  }
+  const double n = a + b;
+  const double log_term = StirlingError(n) - StirlingError(a) - StirlingError(b) - BinomialDeviance(a, n * x) -
+                          BinomialDeviance(b, n * y);
+  return std::sqrt(a * b / (2.0 * std::numbers::pi * n)) * std::exp(log_term);
+}
+
+// x^a e^{-x} / Γ(a + 1)
+double GammaPowerTerm(double a, double x) {
+  if (x == 0.0) {
+    return 0.0;
+  }
+  return std::exp(-StirlingError(a) - BinomialDeviance(a, x)) / std::sqrt(2.0 * std::numbers::pi * a);
+}
+
+// Цепная дробь для I_x(a, b) по модифицированному методу Лентца
+double BetaContinuedFraction(double a, double b, double x) {
+  const double qab = a + b;
+  const double qap = a + 1.0;
+  const double qam = a - 1.0;
+  double c = 1.0;
+  double d = 1.0 - qab * x / qap;
+  d = 1.0 / (std::abs(d) < kTiny ? kTiny : d);
+  double h = d;
+
+  for (int m = 1, limit = MaxIterations(a, b); m <= limit; ++m) {
+    const double m2 = 2.0 * m;
+    double aa = m * (b - m) * x / ((qam + m2) * (a + m2));
+    d = 1.0 + aa * d;
+    d = 1.0 / (std::abs(d) < kTiny ? kTiny : d);
+    c = 1.0 + aa / c;
+    c = std::abs(c) < kTiny ? kTiny : c;
+    h *= d * c;
+
+    aa = -(a + m) * (qab + m) * x / ((a + m2) * (qap + m2));
+    d = 1.0 + aa * d;
+    d = 1.0 / (std::abs(d) < kTiny ? kTiny : d);
+    c = 1.0 + aa / c;
+    c = std::abs(c) < kTiny ? kTiny : c;
+    const double delta = d * c;
+    h *= delta;
+    if (std::abs(delta - 1.0) < kEpsilon) {
+      break;
+    }
+  }
+  return h;
+}
+
+// P(a, x) рядом, при x < a + 1
+double GammaSeries(double a, double x) {
+  double term = 1.0;
+  double sum = 1.0;
+  for (int n = 1, limit = MaxIterations(a, x); n <= limit; ++n) {
+    term *= x / (a + n);
+    sum += term;
+    if (term < sum * kEpsilon) {
+      break;
+    }
+  }
+  return GammaPowerTerm(a, x) * sum;
+}
+
+// Q(a, x) цепной дробью, при x >= a + 1
+double GammaContinuedFraction(double a, double x) {
+  double b = x + 1.0 - a;
+  double c = 1.0 / kTiny;
+  double d = 1.0 / b;
+  double h = d;
+  for (int i = 1, limit = MaxIterations(a, x); i <= limit; ++i) {
+    const double an = -i * (i - a);
+    b += 2.0;
+    d = an * d + b;
+    d = 1.0 / (std::abs(d) < kTiny ? kTiny : d);
+    c = b + an / c;
+    c = std::abs(c) < kTiny ? kTiny : c;
+    const double delta = d * c;
+    h *= delta;
+    if (std::abs(delta - 1.0) < kEpsilon) {
+      break;
+    }
+  }
+  // x^a e^{-x} / Γ(a) = a · x^a e^{-x} / Γ(a + 1)
+  return a * GammaPowerTerm(a, x) * h;
+}
+
+} // namespace
+
+double LogFactorial(std::uint64_t n) {
+  if (n < kLogFactorialTableSize) {
+    return LogFactorialTable()[n];
+  }
+  const auto z = static_cast<double>(n);
+  return (z + 0.5) * std::log(z) - z + kLogSqrt2Pi + StirlingSeries(z);
+}
+
+double LogGamma(double x) {
+  if (!(x > 0.0)) {
+    throw std::invalid_argument("LogGamma requires x > 0");
+  }
+  if (x == std::floor(x) && x <= static_cast<double>(kLogFactorialTableSize)) {
+    return LogFactorialTable()[static_cast<std::size_t>(x) - 1];
+  }
+
+  // Γ(x) = Γ(x + m) / (x (x + 1) ... (x + m - 1)), пока x + m не станет достаточно большим
+  double product = 1.0;
+  while (x < kStirlingSeriesMin) {
+    product *= x;
+    x += 1.0;
+  }
+  return (x - 0.5) * std::log(x) - x + kLogSqrt2Pi + StirlingSeries(x) - std::log(product);
+}
+
+double StirlingError(double z) {
+  if (z >= kStirlingSeriesMin) {
+    return StirlingSeries(z);
+  }
+  if (z == std::floor(z)) {
+    return LogFactorialTable()[static_cast<std::size_t>(z)] - ((z + 0.5) * std::log(z) - z + kLogSqrt2Pi);
+  }
+  return LogGamma(z + 1.0) - ((z + 0.5) * std::log(z) - z + kLogSqrt2Pi);
+}
+
+double BinomialDeviance(double k, double m) {
+  if (std::abs(k - m) < 0.1 * (k + m)) {
+    // Ряд по v = (k - m) / (k + m)
+    const double v = (k - m) / (k + m);
+    double sum = (k - m) * v;
+    double term = 2.0 * k * v;
+    const double v2 = v * v;
+    for (int j = 1; j < 1000; ++j) {
+      term *= v2;
+      const double next = sum + term / (2 * j + 1);
+      if (next == sum) {
+        return sum;
+      }
+      sum = next;
+    }
+    return sum;
+  }
+  return k * std::log(k / m) + m - k;
+}
+
+double BinomialPmf(std::uint64_t k, std::uint64_t n, double p) {
+  if (k > n) {
+    return 0.0;
+  }
+  if (p == 0.0) {
+    return k == 0 ? 1.0 : 0.0;
+  }
+  if (p == 1.0) {
+    return k == n ? 1.0 : 0.0;
+  }
+
+  const auto nd = static_cast<double>(n);
+  if (k == 0) {
+    return std::exp(nd * std::log1p(-p));
+  }
+  if (k == n) {
+    return std::exp(nd * std::log(p));
+  }
+
+  const auto kd = static_cast<double>(k);
+  const double rest = nd - kd;
+  const double log_term = StirlingError(nd) - StirlingError(kd) - StirlingError(rest) -
+                          BinomialDeviance(kd, nd * p) - BinomialDeviance(rest, nd * (1.0 - p));
+  return std::sqrt(nd / (2.0 * std::numbers::pi * kd * rest)) * std::exp(log_term);
+}
+
+double PoissonPmf(std::uint64_t k, double lambda) {
+  if (k == 0) {
+    return std::exp(-lambda);
+  }
+  const auto kd = static_cast<double>(k);
+  return std::exp(-StirlingError(kd) - BinomialDeviance(kd, lambda)) / std::sqrt(2.0 * std::numbers::pi * kd);
+}
+
+double RegularizedIncompleteBeta(double a, double b, double x) {
+  if (!(a > 0.0 && b > 0.0)) {
+    throw std::invalid_argument("Incomplete beta requires a > 0 and b > 0");
+  }
+  if (!(x >= 0.0 && x <= 1.0)) {
+    throw std::invalid_argument("Incomplete beta requires 0 <= x <= 1");
+  }
+  if (x == 0.0 || x == 1.0) {
+    return x;
+  }
+
+  // Дробь быстро сходится при x < (a + 1) / (a + b + 2), иначе I_x(a, b) = 1 - I_{1-x}(b, a)
+  if (x < (a + 1.0) / (a + b + 2.0)) {
+    return BetaPowerTerm(a, b, x) * BetaContinuedFraction(a, b, x) / a;
+  }
+  return 1.0 - BetaPowerTerm(b, a, 1.0 - x) * BetaContinuedFraction(b, a, 1.0 - x) / b;
+}
+
+double RegularizedGammaP(double a, double x) {
+  if (!(a > 0.0 && x >= 0.0)) {
+    throw std::invalid_argument("Incomplete gamma requires a > 0 and x >= 0");
+  }
+  return x < a + 1.0 ? GammaSeries(a, x) : 1.0 - GammaContinuedFraction(a, x);
+}
+
+double RegularizedGammaQ(double a, double x) {
+  if (!(a > 0.0 && x >= 0.0)) {
+    throw std::invalid_argument("Incomplete gamma requires a > 0 and x >= 0");
+  }
+  return x < a + 1.0 ? 1.0 - GammaSeries(a, x) : GammaContinuedFraction(a, x);
+}
+
+double StandardNormalCdf(double x) {
+  return 0.5 * std::erfc(-x / std::numbers::sqrt2);
+}
+
+double StandardNormalQuantile(double p) {
+  // Рациональное приближение Акклама и один шаг Галлея
+  static constexpr double kA[] = {-3.969683028665376e+01, 2.209460984245205e+02, -2.759285104469687e+02,
+                                  1.383577518672690e+02,  -3.066479806614716e+01, 2.506628277459239e+00};
+  static constexpr double kB[] = {-5.447609879822406e+01, 1.615858368580409e+02, -1.556989798598866e+02,
+                                  6.680131188771972e+01,  -1.328068155288572e+01};
+  static constexpr double kC[] = {-7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00,
+                                  -2.549732539343734e+00, 4.374664141464968e+00,  2.938163982698783e+00};
+  static constexpr double kD[] = {7.784695709041462e-03, 3.224671290700398e-01, 2.445134137142996e+00,
+                                  3.754408661907416e+00};
+  constexpr double kLow = 0.02425;
+
+  if (p <= 0.0) {
+    return -std::numeric_limits<double>::infinity();
+  }
+  if (p >= 1.0) {
+    return std::numeric_limits<double>::infinity();
+  }
+
+  double x = 0.0;
+  if (p < kLow || p > 1.0 - kLow) {
+    const double q = std::sqrt(-2.0 * std::log(p < kLow ? p : 1.0 - p));
+    x = (((((kC[0] * q + kC[1]) * q + kC[2]) * q + kC[3]) * q + kC[4]) * q + kC[5]) /
+        ((((kD[0] * q + kD[1]) * q + kD[2]) * q + kD[3]) * q + 1.0);
+    x = p < kLow ? x : -x;
+  } else {
+    const double q = p - 0.5;
+    const double r = q * q;
+    x = (((((kA[0] * r + kA[1]) * r + kA[2]) * r + kA[3]) * r + kA[4]) * r + kA[5]) * q /
+        (((((kB[0] * r + kB[1]) * r + kB[2]) * r + kB[3]) * r + kB[4]) * r + 1.0);
+  }
+
+  const double e = StandardNormalCdf(x) - p;
+  const double u = e * std::sqrt(2.0 * std::numbers::pi) * std::exp(x * x / 2.0);
+  return x - u / (1.0 + x * u / 2.0);
+}
+
+} // namespace ptm
@@ -0,0 +1,38 @@
+#ifndef PTM_SPECIALFUNCTIONS_HPP_
+#define PTM_SPECIALFUNCTIONS_HPP_
+
+#include <cstdint>
+
+namespace ptm {
+
+// ln n!; для n < kLogFactorialTableSize - из общей таблицы, построенной один раз
+constexpr std::uint64_t kLogFactorialTableSize = 1024;
+[[nodiscard]] double LogFactorial(std::uint64_t n);
+
+// ln Γ(x), x > 0. Потокобезопасна, в отличие от std::lgamma
+[[nodiscard]] double LogGamma(double x);
+
+// Ошибка формулы Стирлинга: ln Γ(z + 1) - [(z + 1/2) ln z - z + ln √(2π)], z > 0
+[[nodiscard]] double StirlingError(double z);
+
+// Отклонение k ln(k / m) + m - k без потери точности при k ≈ m
+[[nodiscard]] double BinomialDeviance(double k, double m);
+
+// Вероятности через StirlingError и BinomialDeviance (алгоритм Лоадера), точны и при n, λ ~ 10^6
+[[nodiscard]] double BinomialPmf(std::uint64_t k, std::uint64_t n, double p);
+[[nodiscard]] double PoissonPmf(std::uint64_t k, double lambda);
+
+// Регуляризованная неполная бета-функция I_x(a, b), a, b > 0, 0 <= x <= 1
+[[nodiscard]] double RegularizedIncompleteBeta(double a, double b, double x);
+
+// Регуляризованные неполные гамма-функции P(a, x) и Q(a, x) = 1 - P(a, x), a > 0, x >= 0
+[[nodiscard]] double RegularizedGammaP(double a, double x);
+[[nodiscard]] double RegularizedGammaQ(double a, double x);
+
+// Φ(x) и Φ^{-1}(p) стандартного нормального распределения
+[[nodiscard]] double StandardNormalCdf(double x);
+[[nodiscard]] double StandardNormalQuantile(double p);
+
+} // namespace ptm
+
+#endif // PTM_SPECIALFUNCTIONS_HPP_
@@ -1 +1,44 @@
 #include "UniformDistribution.hpp"
+
+#include <stdexcept>
+
+namespace ptm {
+
+UniformDistribution::UniformDistribution(double a, double b) : a_(a), b_(b) {
+  if (!(a < b)) {
+    throw std::invalid_argument("Uniform distribution requires a < b");
+  }
+}
+
+double UniformDistribution::Pdf(double x) const {
+  return x < a_ || x > b_ ? 0.0 : 1.0 / (b_ - a_);
+}
+
+double UniformDistribution::Cdf(double x) const {
+  if (x <= a_) {
+    return 0.0;
+  }
+  if (x >= b_) {
+    return 1.0;
+  }
+  return (x - a_) / (b_ - a_);
+}
+
+double UniformDistribution::Quantile(double u) const {
+  checkQuantileLevel(u);
+  return a_ + u * (b_ - a_);
+}
+
+double UniformDistribution::Sample(std::mt19937& rng) const {
+  return std::uniform_real_distribution<double>(a_, b_)(rng);
+}
+
+double UniformDistribution::TheoreticalMean() const {
+  return 0.5 * (a_ + b_);
+}
+
+double UniformDistribution::TheoreticalVariance() const {
+  return (b_ - a_) * (b_ - a_) / 12.0;
+}
+
+} // namespace ptm
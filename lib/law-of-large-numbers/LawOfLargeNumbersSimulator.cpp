@@ -1 +1,61 @@
 #include "LawOfLargeNumbersSimulator.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+#include "metrics/Metrics.hpp"
+
+namespace ptm {
+
+LawOfLargeNumbersSimulator::LawOfLargeNumbersSimulator(std::shared_ptr<Distribution> dist) : dist_(std::move(dist)) {
+  if (!dist_) {
+    throw std::invalid_argument("Distribution must not be null");
+  }
+}
+
+LLNPathResult LawOfLargeNumbersSimulator::Simulate(std::mt19937& rng, size_t max_n, size_t step) const {
+  return simulate(rng, max_n, step, nullptr);
+}
+
+LLNPathResult LawOfLargeNumbersSimulator::Simulate(std::mt19937& rng,
+                                                   size_t max_n,
+                                                   size_t step,
+                                                   QuantileSketch& sketch) const {
+  return simulate(rng, max_n, step, &sketch);
+}
+
+LLNPathResult LawOfLargeNumbersSimulator::simulate(std::mt19937& rng,
+                                                   size_t max_n,
+                                                   size_t step,
+                                                   QuantileSketch* sketch) const {
+  if (step == 0) {
+    throw std::invalid_argument("Step must be positive");
+  }
+  PTM_METRICS_TIMER(timer, "lln.simulate");
+  PTM_METRICS_TIMER_ITEMS(timer, max_n);
+  PTM_METRICS_COUNT("lln.samples", max_n);
+
+  const double mu = dist_->TheoreticalMean();
+  LLNPathResult result;
+  result.entries.reserve(max_n / step);
+
+  double sum = 0.0;
+  for (size_t n = 1; n <= max_n; ++n) {
+    const double x = dist_->Sample(rng);
+    if (sketch != nullptr) {
+      sketch->Add(x);
+    }
+    sum += x;
+    if (n % step == 0) {
+      const double mean = sum / static_cast<double>(n);
+      result.entries.push_back({n, mean, std::abs(mean - mu)});
+    }
+  }
+  return result;
+}
+
+std::shared_ptr<Distribution> LawOfLargeNumbersSimulator::GetDistribution() const noexcept {
+  return dist_;
+}
+
+} // namespace ptm
@@ -6,6 +6,7 @@
 
 #include "LLNPathResult.hpp"
 #include "distributions/Distribution.hpp"
+#include "distributions/QuantileSketch.hpp"
 
 namespace ptm {
 class Distribution;
@@ -24,12 +25,16 @@ public:
   // 2) считаем префиксные суммы и выборочные средние
   // 3) для n кратных step сохраняем (n, mean_n, |mean_n - mu|)
   LLNPathResult Simulate(std::mt19937& rng, size_t max_n, size_t step) const;
+  // То же, все X_i дополнительно попадают в скетч (по скетчу со своим seed на поток, затем Merge)
+  LLNPathResult Simulate(std::mt19937& rng, size_t max_n, size_t step, QuantileSketch& sketch) const;
 
   // Доступ к распределению
   [[nodiscard]] std::shared_ptr<Distribution> GetDistribution() const noexcept;
 
 private:
   std::shared_ptr<Distribution> dist_;
+
+  LLNPathResult simulate(std::mt19937& rng, size_t max_n, size_t step, QuantileSketch* sketch) const;
 };
 
 } // namespace ptm
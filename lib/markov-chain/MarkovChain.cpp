@@ -1 +1,239 @@
 #include "MarkovChain.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <tuple>
+
+#include "metrics/CountingMemoryResource.hpp"
+#include "metrics/Metrics.hpp"
+
+namespace ptm {
+
+namespace {
+
+// Сколько вероятностей перемножаем перед одним вызовом log
+constexpr std::size_t kLogBatch = 16;
+// Порог, ниже которого произведение сбрасывается в сумму логарифмов раньше, чтобы не уйти в денормалы
+constexpr double kProductFloor = 1e-250;
+
+} // namespace
+
+MarkovChain::MarkovChain() : MarkovChain(InstrumentedDefaultResource()) {
+}
+
+MarkovChain::MarkovChain(std::pmr::memory_resource* resource) :
+    state_to_index_(resource),
+    index_to_state_(resource),
+    counts_(resource),
+    row_sums_(resource),
+    predecessor_counts_(resource) {
+}
+
+std::pmr::memory_resource* MarkovChain::GetMemoryResource() const noexcept {
+  return row_sums_.get_allocator().resource();
+}
+
+std::string_view MarkovChain::StateAt(StateId id) const {
+  if (id >= index_to_state_.size()) {
+    throw std::out_of_range("State id is out of the chain");
+  }
+  return index_to_state_[id];
+}
+
+size_t MarkovChain::ensureState(std::string_view s) {
+  PTM_METRICS_COUNT("markov_chain.hash_probes", 1);
+  auto it = state_to_index_.find(s);
+  if (it != state_to_index_.end()) {
+    return it->second;
+  }
+
+  PTM_METRICS_COUNT("markov_chain.hash_probes", 1);
+  size_t index = index_to_state_.size();
+  // Ключ и строки счётчиков получают ресурс контейнера через uses-allocator конструирование
+  state_to_index_.emplace(std::piecewise_construct, std::forward_as_tuple(s), std::forward_as_tuple(index));
+  index_to_state_.emplace_back(s);
+  counts_.emplace_back();
+  row_sums_.push_back(0);
+  predecessor_counts_.push_back(0);
+  return index;
+}
+
+void MarkovChain::Train(const std::vector<State>& sequence) {
+  train(sequence);
+}
+
+void MarkovChain::Train(std::span<const std::string_view> sequence) {
+  train(sequence);
+}
+
+template <typename Sequence>
+void MarkovChain::train(const Sequence& sequence) {
+  if (sequence.empty()) {
+    return;
+  }
+  PTM_METRICS_TIMER(timer, "markov_chain.train");
+  PTM_METRICS_TIMER_ITEMS(timer, sequence.size());
+
+  size_t prev = ensureState(sequence.front());
+  for (size_t i = 1; i < sequence.size(); ++i) {
+    size_t next = ensureState(sequence[i]);
+    PTM_METRICS_COUNT("markov_chain.hash_probes", 1);
+    size_t& count = counts_[prev][next];
+    if (count == 0) {
+      ++predecessor_counts_[next];
+      ++distinct_transitions_;
+    }
+    ++count;
+    ++row_sums_[prev];
+    prev = next;
+  }
+}
+
+std::unordered_map<MarkovChain::State, double> MarkovChain::NextDistribution(const State& current) const {
+  std::unordered_map<State, double> result;
+  StateId from = FindState(current);
+  if (from == kUnknownState || row_sums_[from] == 0) {
+    return result;
+  }
+
+  const auto total = static_cast<double>(row_sums_[from]);
+  result.reserve(counts_[from].size());
+  for (const auto& [to, count] : counts_[from]) {
+    result.emplace(State(StateAt(to)), static_cast<double>(count) / total);
+  }
+  return result;
+}
+
+double MarkovChain::TransitionProbability(const State& from, const State& to) const {
+  return SmoothedProbability(FindState(from), FindState(to), Smoothing{.kind = SmoothingKind::None});
+}
+
+std::optional<MarkovChain::State> MarkovChain::SampleNext(const State& current, std::mt19937& rng) const {
+  StateId from = FindState(current);
+  if (from == kUnknownState || row_sums_[from] == 0) {
+    return std::nullopt;
+  }
+
+  std::uniform_int_distribution<size_t> pick(0, row_sums_[from] - 1);
+  size_t target = pick(rng);
+  for (const auto& [to, count] : counts_[from]) {
+    if (target < count) {
+      return State(StateAt(to));
+    }
+    target -= count;
+  }
+  return std::nullopt;
+}
+
+std::vector<MarkovChain::State> MarkovChain::Generate(const State& start, size_t length, std::mt19937& rng) const {
+  std::vector<State> result;
+  if (length == 0) {
+    return result;
+  }
+
+  result.reserve(length);
+  result.push_back(start);
+  while (result.size() < length) {
+    std::optional<State> next = SampleNext(result.back(), rng);
+    if (!next.has_value()) {
+      break;
+    }
+    result.push_back(std::move(*next));
+  }
+  return result;
+}
+
+std::vector<MarkovChain::State> MarkovChain::States() const {
+  std::vector<State> states;
+  states.reserve(index_to_state_.size());
+  for (StateId id = 0; id < index_to_state_.size(); ++id) {
+    states.push_back(State(StateAt(id)));
+  }
+  return states;
+}
+
+std::size_t MarkovChain::GetStateCount() const noexcept {
+  return index_to_state_.size();
+}
+
+MarkovChain::StateId MarkovChain::FindState(std::string_view state) const {
+  PTM_METRICS_COUNT("markov_chain.hash_probes", 1);
+  auto it = state_to_index_.find(state);
+  return it == state_to_index_.end() ? kUnknownState : it->second;
+}
+
+double MarkovChain::SmoothedProbability(StateId from, StateId to, const Smoothing& smoothing) const {
+  const size_t state_count = index_to_state_.size();
+  if ((from != kUnknownState && from >= state_count) || (to != kUnknownState && to >= state_count)) {
+    throw std::out_of_range("State id is out of the chain");
+  }
+
+  size_t count = 0;
+  size_t row_sum = 0;
+  if (from != kUnknownState) {
+    row_sum = row_sums_[from];
+    if (to != kUnknownState) {
+      const auto& row = counts_[from];
+      PTM_METRICS_COUNT("markov_chain.hash_probes", 1);
+      auto it = row.find(to);
+      count = it == row.end() ? 0 : it->second;
+    }
+  }
+
+  // Словарь расширен одним слотом под все неизвестные токены
+  const auto vocabulary = static_cast<double>(state_count + 1);
+
+  switch (smoothing.kind) {
+    case SmoothingKind::None:
+      return row_sum == 0 ? 0.0 : static_cast<double>(count) / static_cast<double>(row_sum);
+
+    case SmoothingKind::AddK:
+      return (static_cast<double>(count) + smoothing.k) /
+             (static_cast<double>(row_sum) + smoothing.k * vocabulary);
+
+    case SmoothingKind::KneserNey: {
+      // Нижний порядок - вероятность продолжения с add-one, чтобы неизвестные токены не давали ноль
+      const double continuation = to == kUnknownState ? 0.0 : static_cast<double>(predecessor_counts_[to]);
+      const double lower = (continuation + 1.0) / (static_cast<double>(distinct_transitions_) + vocabulary);
+      if (row_sum == 0) {
+        return lower;
+      }
+
+      const auto total = static_cast<double>(row_sum);
+      const double discounted = std::max(static_cast<double>(count) - smoothing.discount, 0.0) / total;
+      const double backoff_weight = smoothing.discount * static_cast<double>(counts_[from].size()) / total;
+      return discounted + backoff_weight * lower;
+    }
+  }
+  return 0.0;
+}
+
+double MarkovChain::LogLikelihood(std::span<const StateId> ids, const Smoothing& smoothing) const {
+  if (ids.size() < 2) {
+    return 0.0;
+  }
+  PTM_METRICS_TIMER(timer, "markov_chain.log_likelihood");
+  PTM_METRICS_TIMER_ITEMS(timer, ids.size() - 1);
+
+  // log считается не на каждый переход, а на произведение пачки вероятностей
+  double log_sum = 0.0;
+  double product = 1.0;
+  size_t batched = 0;
+  for (size_t i = 1; i < ids.size(); ++i) {
+    const double p = SmoothedProbability(ids[i - 1], ids[i], smoothing);
+    if (p <= 0.0) {
+      return -std::numeric_limits<double>::infinity();
+    }
+
+    product *= p;
+    if (++batched == kLogBatch || product < kProductFloor) {
+      log_sum += std::log(product);
+      product = 1.0;
+      batched = 0;
+    }
+  }
+  return log_sum + std::log(product);
+}
+
+} // namespace ptm
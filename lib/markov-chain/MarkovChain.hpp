@@ -1,22 +1,40 @@
 #ifndef PTM_MARKOVCHAIN_HPP_
 #define PTM_MARKOVCHAIN_HPP_
 
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory_resource>
 #include <optional>
 #include <random>
+#include <span>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
+#include "Smoothing.hpp"
+
 namespace ptm {
 
 class MarkovChain {
 public:
   using State = std::string;
+  using StateId = std::size_t;
+
+  // Идентификатор для состояний, которых нет в цепи
+  static constexpr StateId kUnknownState = std::numeric_limits<StateId>::max();
 
-  MarkovChain() = default;
+  // Таблицы в ресурсе по умолчанию; с PTM_ENABLE_METRICS их выделения попадают в счётчики memory.*
+  MarkovChain();
+  // Все внутренние таблицы и строки состояний выделяются из resource (например, из
+  // std::pmr::monotonic_buffer_resource, который освобождается целиком). Копия цепи
+  // использует ресурс по умолчанию, перемещение сохраняет ресурс
+  explicit MarkovChain(std::pmr::memory_resource* resource);
 
   // Обучение на одной последовательности (инкрементально)
   void Train(const std::vector<State>& sequence);
+  void Train(std::span<const std::string_view> sequence);
 
   // Получить распределение P(next | current) как map state -> prob
   [[nodiscard]] std::unordered_map<State, double> NextDistribution(const State& current) const;
@@ -34,16 +52,47 @@ public:
   // Все известные состояния
   std::vector<State> States() const;
 
+  [[nodiscard]] std::size_t GetStateCount() const noexcept;
+
+  [[nodiscard]] std::pmr::memory_resource* GetMemoryResource() const noexcept;
+
+  // Индекс состояния; kUnknownState, если состояние не встречалось
+  [[nodiscard]] StateId FindState(std::string_view state) const;
+  // Состояние по индексу, без копирования строки
+  [[nodiscard]] std::string_view StateAt(StateId id) const;
+
+  // Сглаженная вероятность перехода по индексам; kUnknownState допустим с обеих сторон,
+  // другие индексы вне цепи - std::out_of_range
+  [[nodiscard]] double SmoothedProbability(StateId from, StateId to, const Smoothing& smoothing) const;
+
+  // Сумма ln P(ids[i+1] | ids[i]) по всей последовательности индексов
+  [[nodiscard]] double LogLikelihood(std::span<const StateId> ids, const Smoothing& smoothing = {}) const;
+
 private:
+  struct StringHash {
+    using is_transparent = void;
+
+    std::size_t operator()(std::string_view s) const noexcept {
+      return std::hash<std::string_view>{}(s);
+    }
+  };
+
   // отображение state -> index
-  std::unordered_map<State, size_t> state_to_index_;
-  std::vector<State> index_to_state_;
+  std::pmr::unordered_map<std::pmr::string, size_t, StringHash, std::equal_to<>> state_to_index_;
+  std::pmr::vector<std::pmr::string> index_to_state_;
+
+  // counts_[i][j] = c_ij (хранятся только ненулевые), row_sums_[i] = sum_j c_ij
+  std::pmr::vector<std::pmr::unordered_map<size_t, size_t>> counts_;
+  std::pmr::vector<size_t> row_sums_;
+
+  // Для Kneser-Ney: число различных предшественников j и число различных переходов
+  std::pmr::vector<size_t> predecessor_counts_;
+  size_t distinct_transitions_ = 0;
 
-  // counts_[i][j] = c_ij, row_sums_[i] = sum_j c_ij
-  std::vector<std::vector<size_t>> counts_;
-  std::vector<size_t> row_sums_;
+  size_t ensureState(std::string_view s);
 
-  size_t ensureState(const State& s);
+  template <typename Sequence>
+  void train(const Sequence& sequence);
 };
 
 } // namespace ptm
@@ -1 +1,126 @@
 #include "MarkovTextModel.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+
+#include "metrics/Metrics.hpp"
+#include "parallel/ParallelFor.hpp"
+
+namespace ptm {
+
+namespace {
+
+bool IsSpace(char c) {
+  return std::isspace(static_cast<unsigned char>(c)) != 0;
+}
+
+} // namespace
+
+MarkovTextModel::MarkovTextModel(TokenLevel level) : level_(level) {
+}
+
+MarkovTextModel::MarkovTextModel(TokenLevel level, std::pmr::memory_resource* resource) :
+    level_(level),
+    chain_(resource) {
+}
+
+template <typename Callback>
+void MarkovTextModel::forEachToken(std::string_view text, Callback&& callback) const {
+  if (level_ == TokenLevel::Character) {
+    for (size_t i = 0; i < text.size(); ++i) {
+      callback(text.substr(i, 1));
+    }
+    return;
+  }
+
+  size_t i = 0;
+  while (i < text.size()) {
+    while (i < text.size() && IsSpace(text[i])) {
+      ++i;
+    }
+    size_t begin = i;
+    while (i < text.size() && !IsSpace(text[i])) {
+      ++i;
+    }
+    if (i > begin) {
+      callback(text.substr(begin, i - begin));
+    }
+  }
+}
+
+std::string MarkovTextModel::Detokenize(const std::vector<std::string>& tokens) const {
+  std::string result;
+  for (const auto& token : tokens) {
+    if (level_ == TokenLevel::Word && !result.empty()) {
+      result.push_back(' ');
+    }
+    result += token;
+  }
+  return result;
+}
+
+void MarkovTextModel::TrainFromText(const std::string& text) {
+  // Токены - представления внутри text: строки создаются только для новых состояний цепи
+  std::vector<std::string_view> tokens;
+  {
+    PTM_METRICS_TIMER(timer, "markov_text_model.tokenize");
+    forEachToken(text, [&tokens](std::string_view token) { tokens.push_back(token); });
+    PTM_METRICS_TIMER_ITEMS(timer, tokens.size());
+    PTM_METRICS_COUNT("markov_text_model.tokens", tokens.size());
+  }
+  chain_.Train(tokens);
+}
+
+std::string MarkovTextModel::GenerateText(std::size_t num_tokens,
+                                          std::mt19937& rng,
+                                          const std::string& start_token) const {
+  if (num_tokens == 0 || chain_.GetStateCount() == 0) {
+    return "";
+  }
+
+  std::string start = start_token;
+  if (start.empty() || chain_.FindState(start) == MarkovChain::kUnknownState) {
+    start = chain_.StateAt(0);
+  }
+  return Detokenize(chain_.Generate(start, num_tokens, rng));
+}
+
+std::vector<MarkovChain::StateId> MarkovTextModel::Encode(std::string_view text) const {
+  PTM_METRICS_TIMER(timer, "markov_text_model.encode");
+  std::vector<MarkovChain::StateId> ids;
+  forEachToken(text, [this, &ids](std::string_view token) { ids.push_back(chain_.FindState(token)); });
+  PTM_METRICS_TIMER_ITEMS(timer, ids.size());
+  PTM_METRICS_COUNT("markov_text_model.tokens", ids.size());
+  return ids;
+}
+
+TextScore MarkovTextModel::Score(std::string_view text, const Smoothing& smoothing) const {
+  std::vector<MarkovChain::StateId> ids = Encode(text);
+
+  TextScore score;
+  score.num_unknown_tokens = static_cast<size_t>(std::ranges::count(ids, MarkovChain::kUnknownState));
+  score.num_transitions = ids.empty() ? 0 : ids.size() - 1;
+  score.log_likelihood = chain_.LogLikelihood(ids, smoothing);
+  score.perplexity =
+      score.num_transitions == 0 ? 1.0 : std::exp(-score.log_likelihood / static_cast<double>(score.num_transitions));
+  return score;
+}
+
+std::vector<TextScore> MarkovTextModel::ScoreDocuments(const std::vector<std::string>& documents,
+                                                       const Smoothing& smoothing,
+                                                       std::size_t num_threads) const {
+  const std::size_t count = documents.size();
+  std::vector<TextScore> scores(count);
+  // Модель только читается. Документ - отдельный кусок, длинные документы балансирует кража задач
+  ParallelFor(count, count, num_threads, [&](std::size_t i, std::size_t /*begin*/, std::size_t /*end*/) {
+    scores[i] = Score(documents[i], smoothing);
+  });
+  return scores;
+}
+
+const MarkovChain& MarkovTextModel::Chain() const noexcept {
+  return chain_;
+}
+
+} // namespace ptm
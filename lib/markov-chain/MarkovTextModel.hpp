@@ -1,10 +1,15 @@
 #ifndef PTM_MARKOVTEXTMODEL_HPP_
 #define PTM_MARKOVTEXTMODEL_HPP_
 
+#include <memory_resource>
 #include <random>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include "MarkovChain.hpp"
+#include "Smoothing.hpp"
+#include "TextScore.hpp"
 
 namespace ptm {
 
@@ -13,6 +18,8 @@ public:
   enum class TokenLevel { Character, Word }; // NOLINT
 
   explicit MarkovTextModel(TokenLevel level = TokenLevel::Word);
+  // Таблицы цепи выделяются из resource, см. MarkovChain(std::pmr::memory_resource*)
+  MarkovTextModel(TokenLevel level, std::pmr::memory_resource* resource);
 
   // Первичное обучение / дообучение на тексте (одинаково, TrainFromText можно вызывать сколько угодно)
   void TrainFromText(const std::string& text);
@@ -23,14 +30,28 @@ public:
   //   берётся первый известный токен модели
   std::string GenerateText(std::size_t num_tokens, std::mt19937& rng, const std::string& start_token = "") const;
 
+  // Токенизация текста сразу в индексы состояний цепи, без промежуточных строк.
+  // Неизвестные токены кодируются как MarkovChain::kUnknownState
+  [[nodiscard]] std::vector<MarkovChain::StateId> Encode(std::string_view text) const;
+
+  // Логарифм правдоподобия и перплексия текста
+  [[nodiscard]] TextScore Score(std::string_view text, const Smoothing& smoothing = {}) const;
+
+  // Оценка набора документов параллельно; num_threads = 0 - по числу ядер
+  [[nodiscard]] std::vector<TextScore> ScoreDocuments(const std::vector<std::string>& documents,
+                                                      const Smoothing& smoothing = {},
+                                                      std::size_t num_threads = 0) const;
+
   const MarkovChain& Chain() const noexcept;
 
 private:
   TokenLevel level_;
   MarkovChain chain_;
 
-  std::vector<std::string> Tokenize(const std::string& text) const;
   std::string Detokenize(const std::vector<std::string>& tokens) const;
+
+  template <typename Callback>
+  void forEachToken(std::string_view text, Callback&& callback) const;
 };
 
 } // namespace ptm
@@ -0,0 +1,17 @@
+#ifndef PTM_SMOOTHING_HPP_
+#define PTM_SMOOTHING_HPP_
+
+namespace ptm {
+
+// Способ сглаживания оценки P(to | from) при подсчёте правдоподобия
+enum class SmoothingKind { None, AddK, KneserNey }; // NOLINT
+
+struct Smoothing {
+  SmoothingKind kind = SmoothingKind::AddK;
+  double k = 1.0;         // добавка к счётчикам для AddK
+  double discount = 0.75; // абсолютный дисконт для KneserNey
+};
+
+} // namespace ptm
+
+#endif // PTM_SMOOTHING_HPP_
@@ -0,0 +1,18 @@
+#ifndef PTM_TEXTSCORE_HPP_
+#define PTM_TEXTSCORE_HPP_
+
+#include <cstddef>
+
+namespace ptm {
+
+// Результат оценки текста моделью
+struct TextScore {
+  double log_likelihood = 0.0; // сумма ln P(t_{i+1} | t_i)
+  std::size_t num_transitions = 0;
+  std::size_t num_unknown_tokens = 0; // токены, которых нет в словаре модели
+  double perplexity = 0.0;            // exp(-log_likelihood / num_transitions)
+};
+
+} // namespace ptm
+
+#endif // PTM_TEXTSCORE_HPP_
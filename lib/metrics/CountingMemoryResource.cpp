@@ -0,0 +1,40 @@
+#include "CountingMemoryResource.hpp"
+
+#include "Metrics.hpp"
+
+namespace ptm {
+
+CountingMemoryResource::CountingMemoryResource(std::pmr::memory_resource* upstream) noexcept : upstream_(upstream) {
+}
+
+std::pmr::memory_resource* CountingMemoryResource::GetUpstream() const noexcept {
+  return upstream_;
+}
+
+void* CountingMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  void* p = upstream_->allocate(bytes, alignment);
+  PTM_METRICS_COUNT("memory.allocations", 1);
+  PTM_METRICS_COUNT("memory.allocated_bytes", bytes);
+  return p;
+}
+
+void CountingMemoryResource::do_deallocate(void* p, std::size_t bytes, std::size_t alignment) {
+  PTM_METRICS_COUNT("memory.deallocations", 1);
+  upstream_->deallocate(p, bytes, alignment);
+}
+
+bool CountingMemoryResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+  return this == &other;
+}
+
+std::pmr::memory_resource* InstrumentedDefaultResource() noexcept {
+#ifdef PTM_ENABLE_METRICS
+  // Не разрушается до конца программы: таблицы в статических объектах освобождаются позже
+  static CountingMemoryResource* resource = new CountingMemoryResource(std::pmr::get_default_resource());
+  return resource;
+#else
+  return std::pmr::get_default_resource();
+#endif
+}
+
+} // namespace ptm
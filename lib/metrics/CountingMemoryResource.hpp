@@ -0,0 +1,32 @@
+#ifndef PTM_COUNTINGMEMORYRESOURCE_HPP_
+#define PTM_COUNTINGMEMORYRESOURCE_HPP_
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace ptm {
+
+// Обёртка над memory_resource: каждое выделение и освобождение передаётся в upstream и
+// с PTM_ENABLE_METRICS попадает в счётчики memory.allocations, memory.allocated_bytes
+// и memory.deallocations. Без опции - просто пересылка в upstream
+class CountingMemoryResource : public std::pmr::memory_resource {
+public:
+  explicit CountingMemoryResource(std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) noexcept;
+
+  [[nodiscard]] std::pmr::memory_resource* GetUpstream() const noexcept;
+
+private:
+  std::pmr::memory_resource* upstream_;
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+  [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+};
+
+// Ресурс для инструментированных таблиц по умолчанию: с PTM_ENABLE_METRICS - общая
+// CountingMemoryResource над std::pmr::get_default_resource(), без опции - сам ресурс по умолчанию
+[[nodiscard]] std::pmr::memory_resource* InstrumentedDefaultResource() noexcept;
+
+} // namespace ptm
+
+#endif // PTM_COUNTINGMEMORYRESOURCE_HPP_
@@ -0,0 +1,39 @@
+#ifndef PTM_METRICS_HPP_
+#define PTM_METRICS_HPP_
+
+// Инструментирование горячих путей. Включается опцией CMake PTM_ENABLE_METRICS;
+// без неё макросы раскрываются в пустоту и аргументы не вычисляются.
+//
+// PTM_METRICS_COUNT("markov_chain.hash_probes", n);
+// PTM_METRICS_TIMER(timer, "distribution_experiment.run");
+// PTM_METRICS_TIMER_ITEMS(timer, sample_size);
+
+#ifdef PTM_ENABLE_METRICS
+
+#include "MetricsRegistry.hpp"
+
+#define PTM_METRICS_COUNT(name, delta)                                                           \
+  do {                                                                                           \
+    static ::ptm::MetricCounter& ptm_metrics_counter = ::ptm::MetricsRegistry::Global().Counter(name); \
+    ptm_metrics_counter.Add(static_cast<std::uint64_t>(delta));                                  \
+  } while (false)
+
+#define PTM_METRICS_TIMER(var, name)                                                       \
+  static ::ptm::MetricTimer& var##_metric = ::ptm::MetricsRegistry::Global().Timer(name); \
+  ::ptm::ScopedMetricTimer var(var##_metric)
+
+#define PTM_METRICS_TIMER_ITEMS(var, items) var.SetItems(static_cast<std::uint64_t>(items))
+
+#else
+
+#define PTM_METRICS_COUNT(name, delta) \
+  do {                                 \
+  } while (false)
+#define PTM_METRICS_TIMER(var, name)
+#define PTM_METRICS_TIMER_ITEMS(var, items) \
+  do {                                      \
+  } while (false)
+
+#endif
+
+#endif // PTM_METRICS_HPP_
@@ -0,0 +1,195 @@
+#include "MetricsRegistry.hpp"
+
+#include <locale>
+#include <sstream>
+
+namespace ptm {
+
+namespace {
+
+void WriteJsonString(std::ostringstream& out, std::string_view s) {
+  out << '"';
+  for (char c : s) {
+    if (c == '"' || c == '\\') {
+      out << '\\';
+    }
+    out << c;
+  }
+  out << '"';
+}
+
+// Имя метрики Prometheus: [a-zA-Z_:][a-zA-Z0-9_:]*
+std::string PrometheusName(std::string_view name) {
+  std::string result = "ptm_";
+  for (char c : name) {
+    const bool allowed = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+    result.push_back(allowed ? c : '_');
+  }
+  return result;
+}
+
+std::ostringstream MakeStream() {
+  std::ostringstream out;
+  out.imbue(std::locale::classic());
+  out.precision(9);
+  return out;
+}
+
+} // namespace
+
+void MetricCounter::Add(std::uint64_t delta) noexcept {
+  value_.fetch_add(delta, std::memory_order_relaxed);
+}
+
+std::uint64_t MetricCounter::Value() const noexcept {
+  return value_.load(std::memory_order_relaxed);
+}
+
+void MetricCounter::Reset() noexcept {
+  value_.store(0, std::memory_order_relaxed);
+}
+
+void MetricTimer::Record(std::chrono::nanoseconds elapsed, std::uint64_t items) noexcept {
+  calls_.fetch_add(1, std::memory_order_relaxed);
+  items_.fetch_add(items, std::memory_order_relaxed);
+  nanoseconds_.fetch_add(static_cast<std::uint64_t>(elapsed.count()), std::memory_order_relaxed);
+}
+
+std::uint64_t MetricTimer::Calls() const noexcept {
+  return calls_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t MetricTimer::Items() const noexcept {
+  return items_.load(std::memory_order_relaxed);
+}
+
+double MetricTimer::TotalSeconds() const noexcept {
+  return static_cast<double>(nanoseconds_.load(std::memory_order_relaxed)) * 1e-9;
+}
+
+double MetricTimer::ItemsPerSecond() const noexcept {
+  const double seconds = TotalSeconds();
+  return seconds > 0.0 ? static_cast<double>(Items()) / seconds : 0.0;
+}
+
+void MetricTimer::Reset() noexcept {
+  calls_.store(0, std::memory_order_relaxed);
+  items_.store(0, std::memory_order_relaxed);
+  nanoseconds_.store(0, std::memory_order_relaxed);
+}
+
+ScopedMetricTimer::ScopedMetricTimer(MetricTimer& timer) noexcept :
+    timer_(timer),
+    start_(std::chrono::steady_clock::now()) {
+}
+
+ScopedMetricTimer::~ScopedMetricTimer() {
+  timer_.Record(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_),
+                items_);
+}
+
+void ScopedMetricTimer::SetItems(std::uint64_t items) noexcept {
+  items_ = items;
+}
+
+MetricsRegistry& MetricsRegistry::Global() {
+  static MetricsRegistry registry;
+  return registry;
+}
+
+MetricCounter& MetricsRegistry::Counter(std::string_view name) {
+  std::lock_guard lock(mutex_);
+  auto it = counters_.find(name);
+  if (it == counters_.end()) {
+    it = counters_.emplace(std::string(name), std::make_unique<MetricCounter>()).first;
+  }
+  return *it->second;
+}
+
+MetricTimer& MetricsRegistry::Timer(std::string_view name) {
+  std::lock_guard lock(mutex_);
+  auto it = timers_.find(name);
+  if (it == timers_.end()) {
+    it = timers_.emplace(std::string(name), std::make_unique<MetricTimer>()).first;
+  }
+  return *it->second;
+}
+
+std::uint64_t MetricsRegistry::CounterValue(std::string_view name) const {
+  std::lock_guard lock(mutex_);
+  auto it = counters_.find(name);
+  return it == counters_.end() ? 0 : it->second->Value();
+}
+
+const MetricTimer* MetricsRegistry::FindTimer(std::string_view name) const {
+  std::lock_guard lock(mutex_);
+  auto it = timers_.find(name);
+  return it == timers_.end() ? nullptr : it->second.get();
+}
+
+void MetricsRegistry::ForEachCounter(
+    const std::function<void(const std::string&, const MetricCounter&)>& callback) const {
+  std::lock_guard lock(mutex_);
+  for (const auto& [name, counter] : counters_) {
+    callback(name, *counter);
+  }
+}
+
+void MetricsRegistry::ForEachTimer(const std::function<void(const std::string&, const MetricTimer&)>& callback) const {
+  std::lock_guard lock(mutex_);
+  for (const auto& [name, timer] : timers_) {
+    callback(name, *timer);
+  }
+}
+
+std::string MetricsRegistry::ToJson() const {
+  std::ostringstream out = MakeStream();
+  out << "{\"counters\":{";
+  bool first = true;
+  ForEachCounter([&](const std::string& name, const MetricCounter& counter) {
+    out << (first ? "" : ",");
+    WriteJsonString(out, name);
+    out << ':' << counter.Value();
+    first = false;
+  });
+
+  out << "},\"timers\":{";
+  first = true;
+  ForEachTimer([&](const std::string& name, const MetricTimer& timer) {
+    out << (first ? "" : ",");
+    WriteJsonString(out, name);
+    out << ":{\"calls\":" << timer.Calls() << ",\"items\":" << timer.Items()
+        << ",\"total_seconds\":" << timer.TotalSeconds() << ",\"items_per_second\":" << timer.ItemsPerSecond() << '}';
+    first = false;
+  });
+  out << "}}";
+  return out.str();
+}
+
+std::string MetricsRegistry::ToPrometheus() const {
+  std::ostringstream out = MakeStream();
+  ForEachCounter([&](const std::string& name, const MetricCounter& counter) {
+    const std::string metric = PrometheusName(name) + "_total";
+    out << "# TYPE " << metric << " counter\n" << metric << ' ' << counter.Value() << '\n';
+  });
+
+  ForEachTimer([&](const std::string& name, const MetricTimer& timer) {
+    const std::string base = PrometheusName(name);
+    out << "# TYPE " << base << "_seconds_total counter\n" << base << "_seconds_total " << timer.TotalSeconds() << '\n';
+    out << "# TYPE " << base << "_calls_total counter\n" << base << "_calls_total " << timer.Calls() << '\n';
+    out << "# TYPE " << base << "_items_total counter\n" << base << "_items_total " << timer.Items() << '\n';
+  });
+  return out.str();
+}
+
+void MetricsRegistry::Reset() {
+  std::lock_guard lock(mutex_);
+  for (auto& [name, counter] : counters_) {
+    counter->Reset();
+  }
+  for (auto& [name, timer] : timers_) {
+    timer->Reset();
+  }
+}
+
+} // namespace ptm
@@ -0,0 +1,93 @@
+#ifndef PTM_METRICSREGISTRY_HPP_
+#define PTM_METRICSREGISTRY_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+namespace ptm {
+
+// Монотонный счётчик (число сэмплов, обращений к хэш-таблице, выделений памяти и т.п.)
+class MetricCounter {
+public:
+  void Add(std::uint64_t delta) noexcept;
+  [[nodiscard]] std::uint64_t Value() const noexcept;
+  void Reset() noexcept;
+
+private:
+  std::atomic<std::uint64_t> value_{0};
+};
+
+// Суммарное время фазы, число замеров и число обработанных за фазу элементов
+class MetricTimer {
+public:
+  void Record(std::chrono::nanoseconds elapsed, std::uint64_t items) noexcept;
+
+  [[nodiscard]] std::uint64_t Calls() const noexcept;
+  [[nodiscard]] std::uint64_t Items() const noexcept;
+  [[nodiscard]] double TotalSeconds() const noexcept;
+  // Items / TotalSeconds; 0, если времени не набралось
+  [[nodiscard]] double ItemsPerSecond() const noexcept;
+  void Reset() noexcept;
+
+private:
+  std::atomic<std::uint64_t> calls_{0};
+  std::atomic<std::uint64_t> items_{0};
+  std::atomic<std::uint64_t> nanoseconds_{0};
+};
+
+// Замер времени до конца области видимости
+class ScopedMetricTimer {
+public:
+  explicit ScopedMetricTimer(MetricTimer& timer) noexcept;
+  ScopedMetricTimer(const ScopedMetricTimer&) = delete;
+  ScopedMetricTimer& operator=(const ScopedMetricTimer&) = delete;
+  ScopedMetricTimer(ScopedMetricTimer&&) = delete;
+  ScopedMetricTimer& operator=(ScopedMetricTimer&&) = delete;
+  ~ScopedMetricTimer();
+
+  void SetItems(std::uint64_t items) noexcept;
+
+private:
+  MetricTimer& timer_;
+  std::chrono::steady_clock::time_point start_;
+  std::uint64_t items_ = 0;
+};
+
+// Реестр метрик по именам. Ссылки на счётчики и таймеры остаются валидными всё время жизни реестра
+class MetricsRegistry {
+public:
+  static MetricsRegistry& Global();
+
+  MetricCounter& Counter(std::string_view name);
+  MetricTimer& Timer(std::string_view name);
+
+  // std::nullopt-подобные запросы: 0 / nullptr, если метрики с таким именем нет
+  [[nodiscard]] std::uint64_t CounterValue(std::string_view name) const;
+  [[nodiscard]] const MetricTimer* FindTimer(std::string_view name) const;
+
+  void ForEachCounter(const std::function<void(const std::string&, const MetricCounter&)>& callback) const;
+  void ForEachTimer(const std::function<void(const std::string&, const MetricTimer&)>& callback) const;
+
+  [[nodiscard]] std::string ToJson() const;
+  // Текстовый формат экспозиции Prometheus; точки в именах заменяются на '_', префикс ptm_
+  [[nodiscard]] std::string ToPrometheus() const;
+
+  // Обнуляет значения, не удаляя сами метрики
+  void Reset();
+
+private:
+  mutable std::mutex mutex_;
+  std::map<std::string, std::unique_ptr<MetricCounter>, std::less<>> counters_;
+  std::map<std::string, std::unique_ptr<MetricTimer>, std::less<>> timers_;
+};
+
+} // namespace ptm
+
+#endif // PTM_METRICSREGISTRY_HPP_
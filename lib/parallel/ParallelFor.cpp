@@ -0,0 +1,39 @@
+#include "ParallelFor.hpp"
+
+#include <algorithm>
+#include <thread>
+
+#include "WorkStealingPool.hpp"
+
+namespace ptm {
+
+std::size_t ResolveThreadCount(std::size_t num_threads, std::size_t count) noexcept {
+  if (num_threads == 0) {
+    num_threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  return std::max<std::size_t>(1, std::min(num_threads, count));
+}
+
+void ParallelFor(std::size_t count, std::size_t num_chunks, std::size_t num_threads, const ChunkBody& body) {
+  if (count == 0) {
+    return;
+  }
+  num_chunks = std::clamp<std::size_t>(num_chunks, 1, count);
+  num_threads = ResolveThreadCount(num_threads, num_chunks);
+  auto bound = [count, num_chunks](std::size_t chunk) { return count * chunk / num_chunks; };
+
+  if (num_threads == 1) {
+    for (std::size_t chunk = 0; chunk < num_chunks; ++chunk) {
+      body(chunk, bound(chunk), bound(chunk + 1));
+    }
+    return;
+  }
+
+  WorkStealingPool pool(num_threads);
+  for (std::size_t chunk = 0; chunk < num_chunks; ++chunk) {
+    pool.Submit([&body, chunk, begin = bound(chunk), end = bound(chunk + 1)] { body(chunk, begin, end); });
+  }
+  pool.Wait();
+}
+
+} // namespace ptm
@@ -0,0 +1,23 @@
+#ifndef PTM_PARALLELFOR_HPP_
+#define PTM_PARALLELFOR_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+
+namespace ptm {
+
+// Число потоков для num_threads: 0 - по числу ядер; результат не меньше 1 и не больше count
+[[nodiscard]] std::size_t ResolveThreadCount(std::size_t num_threads,
+                                             std::size_t count = std::numeric_limits<std::size_t>::max()) noexcept;
+
+using ChunkBody = std::function<void(std::size_t chunk, std::size_t begin, std::size_t end)>;
+
+// [0, count) делится на num_chunks непрерывных кусков почти равной длины, и body(chunk, begin, end)
+// выполняется для каждого на WorkStealingPool из num_threads потоков (0 - по числу ядер).
+// Один поток или один кусок - выполнение в вызывающем потоке. Первое исключение из body пробрасывается
+void ParallelFor(std::size_t count, std::size_t num_chunks, std::size_t num_threads, const ChunkBody& body);
+
+} // namespace ptm
+
+#endif // PTM_PARALLELFOR_HPP_
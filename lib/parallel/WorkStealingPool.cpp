@@ -0,0 +1,124 @@
+#include "WorkStealingPool.hpp"
+
+#include <algorithm>
+
+#include "ParallelFor.hpp"
+
+namespace ptm {
+
+namespace {
+
+// Номер потока пула, которому принадлежит текущий поток; для остальных - нет
+thread_local const WorkStealingPool* current_pool = nullptr;
+thread_local std::size_t current_index = 0;
+
+} // namespace
+
+WorkStealingPool::WorkStealingPool(std::size_t num_threads) {
+  num_threads = ResolveThreadCount(num_threads);
+
+  queues_.reserve(num_threads);
+  for (std::size_t i = 0; i < num_threads; ++i) {
+    queues_.push_back(std::make_unique<WorkerQueue>());
+  }
+  threads_.reserve(num_threads);
+  for (std::size_t i = 0; i < num_threads; ++i) {
+    threads_.emplace_back(&WorkStealingPool::run, this, i);
+  }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+  {
+    std::lock_guard lock(state_mutex_);
+    stopping_ = true;
+  }
+  wake_.notify_all();
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+void WorkStealingPool::Submit(Task task) {
+  const std::size_t index = current_pool == this ? current_index
+                                                 : next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+  // Счётчики увеличиваются до публикации задачи, чтобы Wait и спящие потоки её не пропустили
+  pending_.fetch_add(1);
+  queued_.fetch_add(1);
+  {
+    std::lock_guard lock(queues_[index]->mutex);
+    queues_[index]->tasks.push_back(std::move(task));
+  }
+  {
+    std::lock_guard lock(state_mutex_);
+  }
+  wake_.notify_one();
+}
+
+void WorkStealingPool::Wait() {
+  std::unique_lock lock(state_mutex_);
+  done_.wait(lock, [this] { return pending_.load() == 0; });
+  if (error_) {
+    std::exception_ptr error = std::exchange(error_, nullptr);
+    std::rethrow_exception(error);
+  }
+}
+
+std::size_t WorkStealingPool::GetThreadCount() const noexcept {
+  return threads_.size();
+}
+
+std::optional<WorkStealingPool::Task> WorkStealingPool::take(std::size_t index) {
+  {
+    WorkerQueue& own = *queues_[index];
+    std::lock_guard lock(own.mutex);
+    if (!own.tasks.empty()) {
+      Task task = std::move(own.tasks.back());
+      own.tasks.pop_back();
+      queued_.fetch_sub(1);
+      return task;
+    }
+  }
+
+  for (std::size_t offset = 1; offset < queues_.size(); ++offset) {
+    WorkerQueue& victim = *queues_[(index + offset) % queues_.size()];
+    std::lock_guard lock(victim.mutex);
+    if (!victim.tasks.empty()) {
+      Task task = std::move(victim.tasks.front());
+      victim.tasks.pop_front();
+      queued_.fetch_sub(1);
+      return task;
+    }
+  }
+  return std::nullopt;
+}
+
+void WorkStealingPool::run(std::size_t index) {
+  current_pool = this;
+  current_index = index;
+
+  while (true) {
+    if (std::optional<Task> task = take(index)) {
+      try {
+        (*task)();
+      } catch (...) {
+        std::lock_guard lock(state_mutex_);
+        if (!error_) {
+          error_ = std::current_exception();
+        }
+      }
+      if (pending_.fetch_sub(1) == 1) {
+        std::lock_guard lock(state_mutex_);
+        done_.notify_all();
+      }
+      continue;
+    }
+
+    std::unique_lock lock(state_mutex_);
+    wake_.wait(lock, [this] { return stopping_ || queued_.load() > 0; });
+    if (stopping_ && queued_.load() == 0) {
+      return;
+    }
+  }
+}
+
+} // namespace ptm
@@ -0,0 +1,69 @@
+#ifndef PTM_WORKSTEALINGPOOL_HPP_
+#define PTM_WORKSTEALINGPOOL_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ptm {
+
+// Пул потоков с очередью на каждый поток. Поток берёт задачи с конца своей очереди,
+// а когда она пуста - крадёт с начала чужих
+class WorkStealingPool {
+public:
+  using Task = std::function<void()>;
+
+  // 0 - по числу ядер
+  explicit WorkStealingPool(std::size_t num_threads = 0);
+  WorkStealingPool(const WorkStealingPool&) = delete;
+  WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+  WorkStealingPool(WorkStealingPool&&) = delete;
+  WorkStealingPool& operator=(WorkStealingPool&&) = delete;
+  // Дорабатывает все поставленные задачи
+  ~WorkStealingPool();
+
+  // Из потока пула задача попадает в его собственную очередь, снаружи - в очереди по кругу
+  void Submit(Task task);
+
+  // Ждёт завершения всех задач и пробрасывает первое исключение из них.
+  // Нельзя вызывать из задачи пула
+  void Wait();
+
+  [[nodiscard]] std::size_t GetThreadCount() const noexcept;
+
+private:
+  struct WorkerQueue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  std::vector<std::unique_ptr<WorkerQueue>> queues_;
+  std::vector<std::thread> threads_;
+  std::atomic<std::size_t> next_queue_{0};
+  // Поставлено, но ещё не взято из очередей
+  std::atomic<std::size_t> queued_{0};
+  // Поставлено, но ещё не выполнено
+  std::atomic<std::size_t> pending_{0};
+
+  std::mutex state_mutex_;
+  std::condition_variable wake_;
+  std::condition_variable done_;
+  bool stopping_ = false;
+  std::exception_ptr error_;
+
+  void run(std::size_t index);
+  std::optional<Task> take(std::size_t index);
+};
+
+} // namespace ptm
+
+#endif // PTM_WORKSTEALINGPOOL_HPP_
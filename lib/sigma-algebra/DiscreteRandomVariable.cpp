@@ -1 +1,119 @@
 #include "DiscreteRandomVariable.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+
+namespace ptm {
+
+namespace {
+
+constexpr size_t kLanes = 4;
+
+} // namespace
+
+DiscreteRandomVariable::DiscreteRandomVariable(const OutcomeSpace& omega,
+                                               const ProbabilityMeasure& P,
+                                               std::vector<double> values) :
+    omega_(omega),
+    P_(P),
+    values_(std::move(values)) {
+  if (values_.size() != P_.GetAtomicProbabilities().size()) {
+    throw std::invalid_argument("Random variable must have a value for every outcome");
+  }
+}
+
+std::optional<double> DiscreteRandomVariable::Value(OutcomeSpace::OutcomeId id) const {
+  if (id >= values_.size()) {
+    return std::nullopt;
+  }
+  return values_[id];
+}
+
+double DiscreteRandomVariable::ExpectedValue() const {
+  return ComputeMoments(values_, P_.GetAtomicProbabilities()).mean;
+}
+
+RandomVariableMoments DiscreteRandomVariable::Moments() const {
+  return ComputeMoments(values_, P_.GetAtomicProbabilities());
+}
+
+void DiscreteRandomVariable::checkTotalMass(double total) {
+  if (!(total > 0.0)) {
+    throw std::invalid_argument("Probability measure has zero total mass");
+  }
+}
+
+FiniteDiscreteDistribution DiscreteRandomVariable::Pushforward() const {
+  std::span<const double> probs = P_.GetAtomicProbabilities();
+  return {values_, std::vector<double>(probs.begin(), probs.end())};
+}
+
+RandomVariableMoments DiscreteRandomVariable::ComputeMoments(std::span<const double> values,
+                                                             std::span<const double> probs) {
+  if (values.size() != probs.size()) {
+    throw std::invalid_argument("Values and probabilities must have the same size");
+  }
+
+  RandomVariableMoments result;
+  if (values.empty()) {
+    checkTotalMass(0.0);
+  }
+
+  // Степенные суммы считаются относительно сдвига, чтобы не терять точность на больших значениях.
+  // Аккумуляторы разбиты на kLanes независимых дорожек - внутренний цикл векторизуется
+  const double shift = values[0];
+  std::array<double, kLanes> s0{};
+  std::array<double, kLanes> s1{};
+  std::array<double, kLanes> s2{};
+  std::array<double, kLanes> s3{};
+  std::array<double, kLanes> s4{};
+
+  const size_t n = values.size();
+  const size_t body = n - n % kLanes;
+  for (size_t i = 0; i < body; i += kLanes) {
+    for (size_t lane = 0; lane < kLanes; ++lane) {
+      const double p = probs[i + lane];
+      const double d = values[i + lane] - shift;
+      const double d2 = d * d;
+      s0[lane] += p;
+      s1[lane] += p * d;
+      s2[lane] += p * d2;
+      s3[lane] += p * d2 * d;
+      s4[lane] += p * d2 * d2;
+    }
+  }
+  for (size_t i = body; i < n; ++i) {
+    const double p = probs[i];
+    const double d = values[i] - shift;
+    const double d2 = d * d;
+    s0[0] += p;
+    s1[0] += p * d;
+    s2[0] += p * d2;
+    s3[0] += p * d2 * d;
+    s4[0] += p * d2 * d2;
+  }
+
+  auto reduce = [](const std::array<double, kLanes>& s) { return (s[0] + s[1]) + (s[2] + s[3]); };
+  const double total = reduce(s0);
+  checkTotalMass(total);
+
+  // Моменты сдвинутой величины -> центральные моменты
+  const double m1 = reduce(s1) / total;
+  const double m2 = reduce(s2) / total;
+  const double m3 = reduce(s3) / total;
+  const double m4 = reduce(s4) / total;
+
+  result.mean = shift + m1;
+  result.variance = std::max(m2 - m1 * m1, 0.0);
+  result.third_central = m3 - 3.0 * m1 * m2 + 2.0 * m1 * m1 * m1;
+  result.fourth_central = m4 - 4.0 * m1 * m3 + 6.0 * m1 * m1 * m2 - 3.0 * m1 * m1 * m1 * m1;
+  if (result.variance > 0.0) {
+    result.skewness = result.third_central / std::pow(result.variance, 1.5);
+    result.excess_kurtosis = result.fourth_central / (result.variance * result.variance) - 3.0;
+  }
+  return result;
+}
+
+} // namespace ptm
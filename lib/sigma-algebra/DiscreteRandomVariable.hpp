@@ -2,10 +2,13 @@
 #define PTM_DISCRETERANDOMVARIABLE_HPP_
 
 #include <optional>
+#include <span>
 #include <vector>
 
 #include "OutcomeSpace.hpp"
 #include "ProbabilityMeasure.hpp"
+#include "RandomVariableMoments.hpp"
+#include "distributions/FiniteDiscreteDistribution.hpp"
 
 namespace ptm {
 
@@ -14,12 +17,38 @@ public:
   DiscreteRandomVariable(const OutcomeSpace& omega, const ProbabilityMeasure& P, std::vector<double> values);
 
   [[nodiscard]] std::optional<double> Value(OutcomeSpace::OutcomeId id) const;
+  // Матожидание и моменты нормируются на полную массу меры, поэтому мера может быть
+  // не нормирована; std::invalid_argument, если масса нулевая
   [[nodiscard]] double ExpectedValue() const;
 
+  // E[X], Var X, третий и четвёртый центральные моменты за один проход
+  [[nodiscard]] RandomVariableMoments Moments() const;
+
+  // E[g(X)], с той же нормировкой, что и ExpectedValue
+  template <typename Function>
+  [[nodiscard]] double Expectation(Function g) const {
+    std::span<const double> probs = P_.GetAtomicProbabilities();
+    double result = 0.0;
+    double total = 0.0;
+    for (size_t i = 0; i < values_.size(); ++i) {
+      result += probs[i] * g(values_[i]);
+      total += probs[i];
+    }
+    checkTotalMass(total);
+    return result / total;
+  }
+
+  // Распределение X: отсортированная таблица значение -> вероятность
+  [[nodiscard]] FiniteDiscreteDistribution Pushforward() const;
+
+  static RandomVariableMoments ComputeMoments(std::span<const double> values, std::span<const double> probs);
+
 private:
   const OutcomeSpace& omega_;
   const ProbabilityMeasure& P_;
   std::vector<double> values_; // X(ω_i)
+
+  static void checkTotalMass(double total);
 };
 
 } // namespace ptm
@@ -1 +1,261 @@
 #include "Event.hpp"
+
+#include <bit>
+#include <stdexcept>
+#include <utility>
+
+namespace ptm {
+
+Event::Event(std::size_t n, std::pmr::memory_resource* resource) : size_(n), heap_words_(resource) {
+  size_t count = wordCount();
+  if (count > kInlineWords) {
+    heap_words_.assign(count, 0);
+  }
+}
+
+Event::Event(std::vector<bool> mask, std::pmr::memory_resource* resource) : Event(mask.size(), resource) {
+  Word* w = words();
+  for (size_t i = 0; i < mask.size(); ++i) {
+    if (mask[i]) {
+      w[i / kWordBits] |= Word{1} << (i % kWordBits);
+    }
+  }
+}
+
+Event::Event(const Event& other) : Event(other, std::pmr::get_default_resource()) {
+}
+
+Event::Event(const Event& other, std::pmr::memory_resource* resource) :
+    size_(other.size_),
+    inline_words_(other.inline_words_),
+    heap_words_(other.heap_words_, resource) {
+}
+
+Event::Event(Event&& other) noexcept :
+    size_(std::exchange(other.size_, 0)),
+    inline_words_(std::exchange(other.inline_words_, {})),
+    heap_words_(std::move(other.heap_words_)) {
+  other.heap_words_.clear();
+}
+
+Event& Event::operator=(Event&& other) {
+  if (this != &other) {
+    size_ = std::exchange(other.size_, 0);
+    inline_words_ = std::exchange(other.inline_words_, {});
+    heap_words_ = std::move(other.heap_words_);
+    other.heap_words_.clear();
+  }
+  return *this;
+}
+
+size_t Event::wordCount() const noexcept {
+  return (size_ + kWordBits - 1) / kWordBits;
+}
+
+Event::Word* Event::words() noexcept {
+  return heap_words_.empty() ? inline_words_.data() : heap_words_.data();
+}
+
+const Event::Word* Event::words() const noexcept {
+  return heap_words_.empty() ? inline_words_.data() : heap_words_.data();
+}
+
+void Event::checkSameSpace(const Event& other) const {
+  if (size_ != other.size_) {
+    throw std::invalid_argument("Events are defined over outcome spaces of different size");
+  }
+}
+
+void Event::clearTail() noexcept {
+  size_t tail = size_ % kWordBits;
+  if (tail != 0) {
+    words()[wordCount() - 1] &= (Word{1} << tail) - 1;
+  }
+}
+
+size_t Event::GetSize() const noexcept {
+  const Word* w = words();
+  size_t count = 0;
+  for (size_t i = 0, n = wordCount(); i < n; ++i) {
+    count += static_cast<size_t>(std::popcount(w[i]));
+  }
+  return count;
+}
+
+size_t Event::GetSpaceSize() const noexcept {
+  return size_;
+}
+
+bool Event::IsEmpty() const noexcept {
+  const Word* w = words();
+  Word any = 0;
+  for (size_t i = 0, n = wordCount(); i < n; ++i) {
+    any |= w[i];
+  }
+  return any == 0;
+}
+
+bool Event::Contains(OutcomeSpace::OutcomeId id) const {
+  if (id >= size_) {
+    return false;
+  }
+  return ((words()[id / kWordBits] >> (id % kWordBits)) & Word{1}) != 0;
+}
+
+void Event::Insert(OutcomeSpace::OutcomeId id) {
+  if (id >= size_) {
+    throw std::out_of_range("Outcome id is out of the event's outcome space");
+  }
+  words()[id / kWordBits] |= Word{1} << (id % kWordBits);
+}
+
+void Event::Erase(OutcomeSpace::OutcomeId id) {
+  if (id >= size_) {
+    throw std::out_of_range("Outcome id is out of the event's outcome space");
+  }
+  words()[id / kWordBits] &= ~(Word{1} << (id % kWordBits));
+}
+
+std::vector<bool> Event::GetMask() const {
+  std::vector<bool> mask(size_, false);
+  for (size_t i = 0; i < size_; ++i) {
+    mask[i] = Contains(i);
+  }
+  return mask;
+}
+
+std::span<const Event::Word> Event::GetWords() const noexcept {
+  return {words(), wordCount()};
+}
+
+size_t Event::Hash() const noexcept {
+  const Word* w = words();
+  std::uint64_t h = 0x9E3779B97F4A7C15ULL ^ size_;
+  for (size_t i = 0, n = wordCount(); i < n; ++i) {
+    // финализатор splitmix64 для каждого слова
+    std::uint64_t x = w[i] + 0x9E3779B97F4A7C15ULL * (i + 1);
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+    h = (h ^ x) * 0x100000001B3ULL;
+  }
+  return static_cast<size_t>(h);
+}
+
+std::pmr::memory_resource* Event::GetMemoryResource() const noexcept {
+  return heap_words_.get_allocator().resource();
+}
+
+// Циклы ниже по словам без ветвлений - компилятор векторизует их при -O3
+Event& Event::operator|=(const Event& other) {
+  checkSameSpace(other);
+  Word* w = words();
+  const Word* o = other.words();
+  for (size_t i = 0, n = wordCount(); i < n; ++i) {
+    w[i] |= o[i];
+  }
+  return *this;
+}
+
+Event& Event::operator&=(const Event& other) {
+  checkSameSpace(other);
+  Word* w = words();
+  const Word* o = other.words();
+  for (size_t i = 0, n = wordCount(); i < n; ++i) {
+    w[i] &= o[i];
+  }
+  return *this;
+}
+
+Event& Event::operator-=(const Event& other) {
+  checkSameSpace(other);
+  Word* w = words();
+  const Word* o = other.words();
+  for (size_t i = 0, n = wordCount(); i < n; ++i) {
+    w[i] &= ~o[i];
+  }
+  return *this;
+}
+
+Event& Event::operator^=(const Event& other) {
+  checkSameSpace(other);
+  Word* w = words();
+  const Word* o = other.words();
+  for (size_t i = 0, n = wordCount(); i < n; ++i) {
+    w[i] ^= o[i];
+  }
+  return *this;
+}
+
+Event Event::operator~() const {
+  Event result(*this);
+  Word* w = result.words();
+  for (size_t i = 0, n = wordCount(); i < n; ++i) {
+    w[i] = ~w[i];
+  }
+  result.clearTail();
+  return result;
+}
+
+Event operator|(Event a, const Event& b) {
+  a |= b;
+  return a;
+}
+
+Event operator&(Event a, const Event& b) {
+  a &= b;
+  return a;
+}
+
+Event operator-(Event a, const Event& b) {
+  a -= b;
+  return a;
+}
+
+Event operator^(Event a, const Event& b) {
+  a ^= b;
+  return a;
+}
+
+bool operator==(const Event& a, const Event& b) noexcept {
+  if (a.size_ != b.size_) {
+    return false;
+  }
+  const Event::Word* wa = a.words();
+  const Event::Word* wb = b.words();
+  Event::Word diff = 0;
+  for (size_t i = 0, n = a.wordCount(); i < n; ++i) {
+    diff |= wa[i] ^ wb[i];
+  }
+  return diff == 0;
+}
+
+Event Event::Empty(std::size_t n, std::pmr::memory_resource* resource) {
+  return Event(n, resource);
+}
+
+Event Event::Full(std::size_t n, std::pmr::memory_resource* resource) {
+  return ~Event(n, resource);
+}
+
+Event Event::Complement(const Event& e) {
+  return ~e;
+}
+
+Event Event::Unite(const Event& a, const Event& b) {
+  return a | b;
+}
+
+Event Event::Intersect(const Event& a, const Event& b) {
+  return a & b;
+}
+
+Event Event::Difference(const Event& a, const Event& b) {
+  return a - b;
+}
+
+Event Event::SymmetricDifference(const Event& a, const Event& b) {
+  return a ^ b;
+}
+
+} // namespace ptm
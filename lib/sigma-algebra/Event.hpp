@@ -1,30 +1,96 @@
 #ifndef PTM_EVENT_HPP_
 #define PTM_EVENT_HPP_
 
+#include <array>
+#include <cstdint>
+#include <memory_resource>
+#include <span>
 #include <vector>
 
 #include "OutcomeSpace.hpp"
 
 namespace ptm {
 
+// Событие - подмножество Ω, хранится как битовая маска из 64-битных слов.
+// Для небольших Ω слова лежат внутри объекта, без выделения памяти, для больших - берутся
+// из memory_resource события. Как у std::pmr-контейнеров, копия (а значит, и результат |, &, -, ^, ~)
+// берёт ресурс по умолчанию, а перемещение и составное присваивание сохраняют ресурс.
+// Копия в заданном ресурсе - Event(e, resource)
 class Event {
 public:
+  using Word = std::uint64_t;
+  static constexpr size_t kWordBits = 64;
+
   Event() = default;
-  explicit Event(std::vector<bool> mask);
+  explicit Event(std::vector<bool> mask, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+  Event(const Event& other);
+  Event(const Event& other, std::pmr::memory_resource* resource);
+  // Событие, из которого переместили, становится пустым событием над пустым Ω
+  Event(Event&& other) noexcept;
+  Event& operator=(const Event& other) = default;
+  Event& operator=(Event&& other);
+  ~Event() = default;
 
+  // Число исходов в событии
   [[nodiscard]] size_t GetSize() const noexcept;
+  // Размер Ω, над которым задано событие
+  [[nodiscard]] size_t GetSpaceSize() const noexcept;
+  [[nodiscard]] bool IsEmpty() const noexcept;
   [[nodiscard]] bool Contains(OutcomeSpace::OutcomeId id) const;
 
-  [[nodiscard]] const std::vector<bool>& GetMask() const noexcept;
+  void Insert(OutcomeSpace::OutcomeId id);
+  void Erase(OutcomeSpace::OutcomeId id);
+
+  [[nodiscard]] std::vector<bool> GetMask() const;
+  // Упакованные слова маски; биты за пределами Ω всегда нулевые
+  [[nodiscard]] std::span<const Word> GetWords() const noexcept;
+
+  // Хэш по упакованным словам маски
+  [[nodiscard]] size_t Hash() const noexcept;
+
+  [[nodiscard]] std::pmr::memory_resource* GetMemoryResource() const noexcept;
+
+  Event& operator|=(const Event& other);
+  Event& operator&=(const Event& other);
+  Event& operator-=(const Event& other); // разность A \ B
+  Event& operator^=(const Event& other); // симметрическая разность
+  Event operator~() const;
 
-  static Event Empty(std::size_t n);
-  static Event Full(std::size_t n);
+  friend Event operator|(Event a, const Event& b);
+  friend Event operator&(Event a, const Event& b);
+  friend Event operator-(Event a, const Event& b);
+  friend Event operator^(Event a, const Event& b);
+  friend bool operator==(const Event& a, const Event& b) noexcept;
+
+  static Event Empty(std::size_t n, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+  static Event Full(std::size_t n, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
   static Event Complement(const Event& e);
   static Event Unite(const Event& a, const Event& b);
   static Event Intersect(const Event& a, const Event& b);
+  static Event Difference(const Event& a, const Event& b);
+  static Event SymmetricDifference(const Event& a, const Event& b);
 
 private:
-  std::vector<bool> mask_;
+  static constexpr size_t kInlineWords = 4;
+
+  size_t size_ = 0;
+  std::array<Word, kInlineWords> inline_words_{};
+  std::pmr::vector<Word> heap_words_;
+
+  Event(std::size_t n, std::pmr::memory_resource* resource);
+
+  [[nodiscard]] size_t wordCount() const noexcept;
+  [[nodiscard]] Word* words() noexcept;
+  [[nodiscard]] const Word* words() const noexcept;
+  void checkSameSpace(const Event& other) const;
+  void clearTail() noexcept;
+};
+
+struct EventHash {
+  size_t operator()(const Event& e) const noexcept {
+    return e.Hash();
+  }
 };
 
 } // namespace ptm
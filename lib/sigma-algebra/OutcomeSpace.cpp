@@ -1 +1,133 @@
 #include "OutcomeSpace.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+namespace ptm {
+
+OutcomeSpace::OutcomeSpace(const OutcomeSpace& other) {
+  size_t name_bytes = 0;
+  for (std::string_view name : other.names_) {
+    name_bytes += name.size();
+  }
+  Reserve(other.names_.size(), name_bytes);
+  for (std::string_view name : other.names_) {
+    AddOutcome(name);
+  }
+}
+
+OutcomeSpace& OutcomeSpace::operator=(const OutcomeSpace& other) {
+  if (this != &other) {
+    OutcomeSpace copy(other);
+    *this = std::move(copy);
+  }
+  return *this;
+}
+
+OutcomeSpace::OutcomeSpace(OutcomeSpace&& other) noexcept :
+    chunks_(std::move(other.chunks_)),
+    chunk_used_(std::exchange(other.chunk_used_, 0)),
+    chunk_capacity_(std::exchange(other.chunk_capacity_, 0)),
+    names_(std::move(other.names_)),
+    index_(std::move(other.index_)) {
+  other.chunks_.clear();
+  other.names_.clear();
+  other.index_.clear();
+}
+
+OutcomeSpace& OutcomeSpace::operator=(OutcomeSpace&& other) noexcept {
+  if (this != &other) {
+    chunks_ = std::move(other.chunks_);
+    chunk_used_ = std::exchange(other.chunk_used_, 0);
+    chunk_capacity_ = std::exchange(other.chunk_capacity_, 0);
+    names_ = std::move(other.names_);
+    index_ = std::move(other.index_);
+    other.chunks_.clear();
+    other.names_.clear();
+    other.index_.clear();
+  }
+  return *this;
+}
+
+void OutcomeSpace::allocateChunk(size_t capacity) {
+  chunks_.push_back(std::make_unique<char[]>(capacity));
+  chunk_used_ = 0;
+  chunk_capacity_ = capacity;
+}
+
+std::string_view OutcomeSpace::store(std::string_view name) {
+  // Пустому имени блок не нужен, а в новом или перемещённом пространстве блоков ещё нет
+  if (name.empty()) {
+    return {};
+  }
+  if (chunk_capacity_ - chunk_used_ < name.size()) {
+    allocateChunk(std::max(kChunkSize, name.size()));
+  }
+  char* destination = chunks_.back().get() + chunk_used_;
+  std::memcpy(destination, name.data(), name.size());
+  chunk_used_ += name.size();
+  return {destination, name.size()};
+}
+
+void OutcomeSpace::Reserve(size_t outcomes, size_t name_bytes) {
+  names_.reserve(names_.size() + outcomes);
+  index_.reserve(index_.size() + outcomes);
+  if (chunk_capacity_ - chunk_used_ < name_bytes) {
+    allocateChunk(std::max(kChunkSize, name_bytes));
+  }
+}
+
+OutcomeSpace::OutcomeId OutcomeSpace::AddOutcome(std::string_view name) {
+  if (index_.contains(name)) {
+    throw std::invalid_argument("Outcome with this name already exists");
+  }
+
+  std::string_view stored = store(name);
+  const OutcomeId id = names_.size();
+  names_.push_back(stored);
+  index_.emplace(stored, id);
+  return id;
+}
+
+OutcomeSpace::OutcomeId OutcomeSpace::AddOutcomes(std::span<const std::string> names) {
+  size_t name_bytes = 0;
+  for (const auto& name : names) {
+    name_bytes += name.size();
+  }
+  Reserve(names.size(), name_bytes);
+
+  const OutcomeId first = names_.size();
+  try {
+    for (const auto& name : names) {
+      AddOutcome(name);
+    }
+  } catch (...) {
+    // Откат: место в арене остаётся занятым, но исходы пропадают из индекса
+    for (OutcomeId id = first; id < names_.size(); ++id) {
+      index_.erase(names_[id]);
+    }
+    names_.resize(first);
+    throw;
+  }
+  return first;
+}
+
+size_t OutcomeSpace::GetSize() const noexcept {
+  return names_.size();
+}
+
+std::string_view OutcomeSpace::GetName(OutcomeId id) const {
+  return names_.at(id);
+}
+
+std::optional<OutcomeSpace::OutcomeId> OutcomeSpace::Find(std::string_view name) const {
+  auto it = index_.find(name);
+  if (it == index_.end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
+} // namespace ptm
@@ -1,24 +1,58 @@
 #ifndef PTM_OUTCOMESPACE_HPP_
 #define PTM_OUTCOMESPACE_HPP_
 
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace ptm {
 
+// Конечное пространство исходов. Имена исходов уникальны и лежат подряд в блоках арены,
+// обратный индекс имя -> id даёт поиск за O(1)
 class OutcomeSpace {
 public:
   using OutcomeId = size_t;
 
   OutcomeSpace() = default;
+  OutcomeSpace(const OutcomeSpace& other);
+  OutcomeSpace& operator=(const OutcomeSpace& other);
+  // Пространство, из которого переместили, становится пустым и пригодным для AddOutcome
+  OutcomeSpace(OutcomeSpace&& other) noexcept;
+  OutcomeSpace& operator=(OutcomeSpace&& other) noexcept;
+  ~OutcomeSpace() = default;
 
-  OutcomeId AddOutcome(const std::string& name);
+  // std::invalid_argument, если исход с таким именем уже есть
+  OutcomeId AddOutcome(std::string_view name);
+
+  // Добавить исходы пачкой с одним выделением памяти; возвращает id первого.
+  // При повторяющемся имени пространство остаётся прежним
+  OutcomeId AddOutcomes(std::span<const std::string> names);
+
+  // Зарезервировать место под outcomes исходов с суммарной длиной имён name_bytes
+  void Reserve(size_t outcomes, size_t name_bytes);
 
   [[nodiscard]] size_t GetSize() const noexcept;
-  [[nodiscard]] const std::string& GetName(OutcomeId id) const;
+  [[nodiscard]] std::string_view GetName(OutcomeId id) const;
+  [[nodiscard]] std::optional<OutcomeId> Find(std::string_view name) const;
 
 private:
-  std::vector<std::string> names_;
+  static constexpr size_t kChunkSize = 64 * 1024;
+
+  // Блоки не перемещаются при росте, поэтому string_view на имена остаются валидными
+  std::vector<std::unique_ptr<char[]>> chunks_;
+  size_t chunk_used_ = 0;
+  size_t chunk_capacity_ = 0;
+
+  std::vector<std::string_view> names_;
+  std::unordered_map<std::string_view, OutcomeId> index_;
+
+  std::string_view store(std::string_view name);
+  void allocateChunk(size_t capacity);
 };
 
 } // namespace ptm
@@ -1 +1,189 @@
 #include "ProbabilityMeasure.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "metrics/Metrics.hpp"
+
+namespace ptm {
+
+namespace {
+
+constexpr size_t kWordBits = Event::kWordBits;
+// Сколько слов маски обрабатывается за блок: 64 * 64 атома * 8 байт = 32 КиБ вероятностей
+constexpr size_t kBlockWords = 64;
+
+// Суммирование Ноймайера
+struct CompensatedSum {
+  double sum = 0.0;
+  double compensation = 0.0;
+
+  void Add(double x) {
+    double t = sum + x;
+    if (std::abs(sum) >= std::abs(x)) {
+      compensation += (sum - t) + x;
+    } else {
+      compensation += (x - t) + sum;
+    }
+    sum = t;
+  }
+
+  [[nodiscard]] double Value() const {
+    return sum + compensation;
+  }
+};
+
+// Сумма вероятностей атомов, отмеченных в одном слове маски. Без ветвлений по битам
+double MaskedWordSum(const double* probs, Event::Word word) {
+  double acc[4] = {0.0, 0.0, 0.0, 0.0};
+  if (word == ~Event::Word{0}) {
+    for (size_t b = 0; b < kWordBits; ++b) {
+      acc[b % 4] += probs[b];
+    }
+  } else {
+    for (size_t b = 0; b < kWordBits; ++b) {
+      acc[b % 4] += ((word >> b) & Event::Word{1}) != 0 ? probs[b] : 0.0;
+    }
+  }
+  return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+}
+
+double MaskedRangeSum(const double* probs, std::span<const Event::Word> words, size_t begin, size_t end) {
+  double acc = 0.0;
+  for (size_t i = begin; i < end; ++i) {
+    if (words[i] != 0) {
+      acc += MaskedWordSum(probs + i * kWordBits, words[i]);
+    }
+  }
+  return acc;
+}
+
+} // namespace
+
+ProbabilityMeasure::ProbabilityMeasure(const OutcomeSpace& omega) :
+    omega_(omega),
+    size_(omega.GetSize()),
+    atom_probs_((size_ + kWordBits - 1) / kWordBits * kWordBits, 0.0) {
+}
+
+void ProbabilityMeasure::checkEvent(const Event& event) const {
+  if (event.GetSpaceSize() != size_) {
+    throw std::invalid_argument("Event is defined over a different outcome space");
+  }
+}
+
+void ProbabilityMeasure::SetAtomicProbability(OutcomeSpace::OutcomeId id, double p) {
+  if (id >= size_) {
+    throw std::out_of_range("Outcome id is out of the outcome space");
+  }
+  atom_probs_[id] = p;
+
+  std::lock_guard lock(cache_.mutex);
+  cache_.values.clear();
+}
+
+double ProbabilityMeasure::GetAtomicProbability(OutcomeSpace::OutcomeId id) const {
+  if (id >= size_) {
+    throw std::out_of_range("Outcome id is out of the outcome space");
+  }
+  return atom_probs_[id];
+}
+
+std::span<const double> ProbabilityMeasure::GetAtomicProbabilities() const noexcept {
+  return {atom_probs_.data(), size_};
+}
+
+bool ProbabilityMeasure::IsValid(double eps) const {
+  CompensatedSum total;
+  for (double p : atom_probs_) {
+    if (p < 0.0 || p > 1.0 + eps) {
+      return false;
+    }
+    total.Add(p);
+  }
+  return std::abs(total.Value() - 1.0) <= eps;
+}
+
+void ProbabilityMeasure::EnableCache(bool enabled) {
+  cache_enabled_ = enabled;
+  std::lock_guard lock(cache_.mutex);
+  cache_.values.clear();
+}
+
+double ProbabilityMeasure::Probability(const Event& event) const {
+  checkEvent(event);
+  if (cache_enabled_) {
+    std::lock_guard lock(cache_.mutex);
+    PTM_METRICS_COUNT("probability_measure.hash_probes", 1);
+    auto it = cache_.values.find(event);
+    if (it != cache_.values.end()) {
+      return it->second;
+    }
+  }
+
+  std::span<const Event::Word> words = event.GetWords();
+  CompensatedSum total;
+  for (size_t begin = 0; begin < words.size(); begin += kBlockWords) {
+    total.Add(MaskedRangeSum(atom_probs_.data(), words, begin, std::min(begin + kBlockWords, words.size())));
+  }
+  double result = total.Value();
+
+  if (cache_enabled_) {
+    std::lock_guard lock(cache_.mutex);
+    PTM_METRICS_COUNT("probability_measure.hash_probes", 1);
+    cache_.values.emplace(Event(event, std::pmr::get_default_resource()), result);
+  }
+  return result;
+}
+
+std::vector<double> ProbabilityMeasure::Probability(std::span<const Event> events) const {
+  std::vector<double> result(events.size(), 0.0);
+
+  // Индексы событий, которые нужно посчитать (остальные взяты из кэша)
+  std::vector<size_t> pending;
+  pending.reserve(events.size());
+  {
+    std::unique_lock<std::mutex> lock(cache_.mutex, std::defer_lock);
+    if (cache_enabled_) {
+      lock.lock();
+    }
+    for (size_t i = 0; i < events.size(); ++i) {
+      checkEvent(events[i]);
+      if (cache_enabled_) {
+        PTM_METRICS_COUNT("probability_measure.hash_probes", 1);
+        auto it = cache_.values.find(events[i]);
+        if (it != cache_.values.end()) {
+          result[i] = it->second;
+          continue;
+        }
+      }
+      pending.push_back(i);
+    }
+  }
+
+  // Внешний цикл по блокам атомов, внутренний по событиям: блок остаётся в кэше процессора
+  std::vector<CompensatedSum> totals(pending.size());
+  const size_t word_count = atom_probs_.size() / kWordBits;
+  for (size_t begin = 0; begin < word_count; begin += kBlockWords) {
+    const size_t end = std::min(begin + kBlockWords, word_count);
+    for (size_t j = 0; j < pending.size(); ++j) {
+      totals[j].Add(MaskedRangeSum(atom_probs_.data(), events[pending[j]].GetWords(), begin, end));
+    }
+  }
+
+  for (size_t j = 0; j < pending.size(); ++j) {
+    result[pending[j]] = totals[j].Value();
+  }
+
+  if (cache_enabled_) {
+    std::lock_guard lock(cache_.mutex);
+    for (size_t i : pending) {
+      PTM_METRICS_COUNT("probability_measure.hash_probes", 1);
+      cache_.values.emplace(Event(events[i], std::pmr::get_default_resource()), result[i]);
+    }
+  }
+  return result;
+}
+
+} // namespace ptm
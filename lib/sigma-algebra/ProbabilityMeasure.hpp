@@ -1,6 +1,9 @@
 #ifndef PTM_PROBABILITYMEASURE_HPP_
 #define PTM_PROBABILITYMEASURE_HPP_
 
+#include <mutex>
+#include <span>
+#include <unordered_map>
 #include <vector>
 
 #include "Event.hpp"
@@ -15,14 +18,45 @@ public:
   // Задать P({ω_i}) = p_i
   void SetAtomicProbability(OutcomeSpace::OutcomeId id, double p);
   [[nodiscard]] double GetAtomicProbability(OutcomeSpace::OutcomeId id) const;
+  // Вероятности всех атомов подряд, p_i для i < |Ω|
+  [[nodiscard]] std::span<const double> GetAtomicProbabilities() const noexcept;
 
   [[nodiscard]] bool IsValid(double eps) const;
 
   [[nodiscard]] double Probability(const Event& event) const;
 
+  // Вероятности набора событий за один проход по атомам блоками
+  [[nodiscard]] std::vector<double> Probability(std::span<const Event> events) const;
+
+  // Запоминать вероятности уже встречавшихся событий. Сбрасывается при изменении атомов
+  void EnableCache(bool enabled);
+
 private:
+  // Копия меры получает пустой кэш. Ключи копируются в ресурс по умолчанию: кэш живёт
+  // дольше арены, из которой могло прийти событие запроса
+  struct ProbabilityCache {
+    std::unordered_map<Event, double, EventHash> values;
+    std::mutex mutex;
+
+    ProbabilityCache() = default;
+    ProbabilityCache(const ProbabilityCache& /*other*/) {
+    }
+    ProbabilityCache& operator=(const ProbabilityCache& /*other*/) { // NOLINT(bugprone-unhandled-self-assignment)
+      values.clear();
+      return *this;
+    }
+    ~ProbabilityCache() = default;
+  };
+
   const OutcomeSpace& omega_;
+  size_t size_;
+  // Дополнено нулями до целого числа слов маски
   std::vector<double> atom_probs_;
+
+  bool cache_enabled_ = false;
+  mutable ProbabilityCache cache_;
+
+  void checkEvent(const Event& event) const;
 };
 
 }; // namespace ptm
@@ -0,0 +1,163 @@
+#include "ProductProbabilitySpace.hpp"
+
+#include <limits>
+#include <stdexcept>
+
+#include "DiscreteRandomVariable.hpp"
+
+namespace ptm {
+
+void ProductProbabilitySpace::AddFactor(const OutcomeSpace& omega, const ProbabilityMeasure& P) {
+  const size_t size = P.GetAtomicProbabilities().size();
+  if (size != omega.GetSize()) {
+    throw std::invalid_argument("Probability measure is defined over a different outcome space");
+  }
+
+  factors_.push_back({&omega, &P, size});
+  if (size == 0) {
+    size_ = 0;
+    size_overflow_ = false;
+  } else if (size_ != 0 && size_ > std::numeric_limits<OutcomeId>::max() / size) {
+    size_overflow_ = true;
+  } else {
+    size_ *= size;
+  }
+}
+
+ProductProbabilitySpace ProductProbabilitySpace::Power(const OutcomeSpace& omega,
+                                                       const ProbabilityMeasure& P,
+                                                       size_t n) {
+  ProductProbabilitySpace result;
+  result.factors_.reserve(n);
+  for (size_t i = 0; i < n; ++i) {
+    result.AddFactor(omega, P);
+  }
+  return result;
+}
+
+size_t ProductProbabilitySpace::GetFactorCount() const noexcept {
+  return factors_.size();
+}
+
+const OutcomeSpace& ProductProbabilitySpace::GetFactorSpace(size_t factor) const {
+  return *factors_.at(factor).omega;
+}
+
+const ProbabilityMeasure& ProductProbabilitySpace::GetFactorMeasure(size_t factor) const {
+  return *factors_.at(factor).P;
+}
+
+ProductProbabilitySpace::OutcomeId ProductProbabilitySpace::GetSize() const {
+  if (size_overflow_) {
+    throw std::overflow_error("Product space is too large to enumerate its outcomes");
+  }
+  return size_;
+}
+
+ProductProbabilitySpace::OutcomeId ProductProbabilitySpace::Encode(
+    std::span<const OutcomeSpace::OutcomeId> coordinates) const {
+  if (coordinates.size() != factors_.size()) {
+    throw std::invalid_argument("Number of coordinates must match the number of factors");
+  }
+  if (size_overflow_) {
+    throw std::overflow_error("Product space is too large to enumerate its outcomes");
+  }
+
+  OutcomeId id = 0;
+  for (size_t i = 0; i < factors_.size(); ++i) {
+    if (coordinates[i] >= factors_[i].size) {
+      throw std::out_of_range("Coordinate is out of the factor's outcome space");
+    }
+    id = id * factors_[i].size + coordinates[i];
+  }
+  return id;
+}
+
+std::vector<OutcomeSpace::OutcomeId> ProductProbabilitySpace::Decode(OutcomeId id) const {
+  if (id >= GetSize()) {
+    throw std::out_of_range("Outcome id is out of the product space");
+  }
+
+  std::vector<OutcomeSpace::OutcomeId> coordinates(factors_.size());
+  for (size_t i = factors_.size(); i-- > 0;) {
+    coordinates[i] = static_cast<OutcomeSpace::OutcomeId>(id % factors_[i].size);
+    id /= factors_[i].size;
+  }
+  return coordinates;
+}
+
+std::string ProductProbabilitySpace::GetName(OutcomeId id) const {
+  std::vector<OutcomeSpace::OutcomeId> coordinates = Decode(id);
+  std::string name = "(";
+  for (size_t i = 0; i < coordinates.size(); ++i) {
+    if (i > 0) {
+      name += ", ";
+    }
+    name += factors_[i].omega->GetName(coordinates[i]);
+  }
+  name += ")";
+  return name;
+}
+
+double ProductProbabilitySpace::GetAtomicProbability(OutcomeId id) const {
+  std::vector<OutcomeSpace::OutcomeId> coordinates = Decode(id);
+  double p = 1.0;
+  for (size_t i = 0; i < coordinates.size(); ++i) {
+    p *= factors_[i].P->GetAtomicProbability(coordinates[i]);
+  }
+  return p;
+}
+
+double ProductProbabilitySpace::Probability(std::span<const Event> factor_events) const {
+  if (factor_events.size() != factors_.size()) {
+    throw std::invalid_argument("Product event must have one event per factor");
+  }
+
+  double p = 1.0;
+  for (size_t i = 0; i < factors_.size() && p != 0.0; ++i) {
+    p *= factors_[i].P->Probability(factor_events[i]);
+  }
+  return p;
+}
+
+void ProductProbabilitySpace::checkFactorValues(const std::vector<std::vector<double>>& factor_values) const {
+  if (factor_values.size() != factors_.size()) {
+    throw std::invalid_argument("Separable random variable must have one component per factor");
+  }
+  for (size_t i = 0; i < factors_.size(); ++i) {
+    if (factor_values[i].size() != factors_[i].size) {
+      throw std::invalid_argument("Component must have a value for every outcome of its factor");
+    }
+  }
+}
+
+double ProductProbabilitySpace::ExpectationOfSum(const std::vector<std::vector<double>>& factor_values) const {
+  checkFactorValues(factor_values);
+  double result = 0.0;
+  for (size_t i = 0; i < factors_.size(); ++i) {
+    result += DiscreteRandomVariable::ComputeMoments(factor_values[i], factors_[i].P->GetAtomicProbabilities()).mean;
+  }
+  return result;
+}
+
+double ProductProbabilitySpace::VarianceOfSum(const std::vector<std::vector<double>>& factor_values) const {
+  checkFactorValues(factor_values);
+  // Слагаемые независимы, дисперсии складываются
+  double result = 0.0;
+  for (size_t i = 0; i < factors_.size(); ++i) {
+    result +=
+        DiscreteRandomVariable::ComputeMoments(factor_values[i], factors_[i].P->GetAtomicProbabilities()).variance;
+  }
+  return result;
+}
+
+double ProductProbabilitySpace::ExpectationOfProduct(const std::vector<std::vector<double>>& factor_values) const {
+  checkFactorValues(factor_values);
+  double result = 1.0;
+  for (size_t i = 0; i < factors_.size(); ++i) {
+    result *= DiscreteRandomVariable::ComputeMoments(factor_values[i], factors_[i].P->GetAtomicProbabilities()).mean;
+  }
+  return result;
+}
+
+} // namespace ptm
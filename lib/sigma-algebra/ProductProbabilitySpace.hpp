@@ -0,0 +1,70 @@
+#ifndef PTM_PRODUCTPROBABILITYSPACE_HPP_
+#define PTM_PRODUCTPROBABILITYSPACE_HPP_
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "Event.hpp"
+#include "OutcomeSpace.hpp"
+#include "ProbabilityMeasure.hpp"
+
+namespace ptm {
+
+// Произведение независимых вероятностных пространств (Ω_1 × ... × Ω_n, P_1 ⊗ ... ⊗ P_n).
+// Декартово произведение не строится: исход кодируется числом в смешанной системе счисления
+// (первый сомножитель - старший разряд), имена исходов собираются по запросу.
+// Сомножители хранятся по ссылке и должны жить дольше произведения
+class ProductProbabilitySpace {
+public:
+  using OutcomeId = std::uint64_t;
+
+  ProductProbabilitySpace() = default;
+
+  void AddFactor(const OutcomeSpace& omega, const ProbabilityMeasure& P);
+
+  // n независимых повторений одного испытания
+  static ProductProbabilitySpace Power(const OutcomeSpace& omega, const ProbabilityMeasure& P, size_t n);
+
+  [[nodiscard]] size_t GetFactorCount() const noexcept;
+  [[nodiscard]] const OutcomeSpace& GetFactorSpace(size_t factor) const;
+  [[nodiscard]] const ProbabilityMeasure& GetFactorMeasure(size_t factor) const;
+
+  // |Ω_1| * ... * |Ω_n|; std::overflow_error, если не помещается в OutcomeId
+  [[nodiscard]] OutcomeId GetSize() const;
+
+  [[nodiscard]] OutcomeId Encode(std::span<const OutcomeSpace::OutcomeId> coordinates) const;
+  [[nodiscard]] std::vector<OutcomeSpace::OutcomeId> Decode(OutcomeId id) const;
+
+  // Имя вида "(a, b, c)"
+  [[nodiscard]] std::string GetName(OutcomeId id) const;
+
+  [[nodiscard]] double GetAtomicProbability(OutcomeId id) const;
+
+  // P(E_1 × ... × E_n) = P_1(E_1) * ... * P_n(E_n)
+  [[nodiscard]] double Probability(std::span<const Event> factor_events) const;
+
+  // Сепарабельные величины: factor_values[i][ω] - значение f_i на исходе ω сомножителя i.
+  // E[Σ f_i], Var[Σ f_i] и E[∏ f_i] считаются по сомножителям, без перебора произведения
+  [[nodiscard]] double ExpectationOfSum(const std::vector<std::vector<double>>& factor_values) const;
+  [[nodiscard]] double VarianceOfSum(const std::vector<std::vector<double>>& factor_values) const;
+  [[nodiscard]] double ExpectationOfProduct(const std::vector<std::vector<double>>& factor_values) const;
+
+private:
+  struct Factor {
+    const OutcomeSpace* omega;
+    const ProbabilityMeasure* P;
+    size_t size;
+  };
+
+  std::vector<Factor> factors_;
+  OutcomeId size_ = 1;
+  bool size_overflow_ = false;
+
+  void checkFactorValues(const std::vector<std::vector<double>>& factor_values) const;
+};
+
+} // namespace ptm
+
+#endif // PTM_PRODUCTPROBABILITYSPACE_HPP_
@@ -0,0 +1,18 @@
+#ifndef PTM_RANDOMVARIABLEMOMENTS_HPP_
+#define PTM_RANDOMVARIABLEMOMENTS_HPP_
+
+namespace ptm {
+
+// Моменты дискретной случайной величины
+struct RandomVariableMoments {
+  double mean = 0.0;
+  double variance = 0.0;
+  double third_central = 0.0;  // E[(X - EX)^3]
+  double fourth_central = 0.0; // E[(X - EX)^4]
+  double skewness = 0.0;
+  double excess_kurtosis = 0.0;
+};
+
+} // namespace ptm
+
+#endif // PTM_RANDOMVARIABLEMOMENTS_HPP_
@@ -1 +1,271 @@
 #include "SigmaAlgebra.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+#include "parallel/ParallelFor.hpp"
+
+namespace ptm {
+
+namespace {
+
+// Больше атомов перечислять всё равно бессмысленно: 2^k событий не поместятся в память
+constexpr size_t kMaxMaterializedAtoms = 30;
+// Меньшие наборы событий проверяются в одном потоке
+constexpr size_t kParallelThreshold = 1024;
+
+size_t FirstOutcome(const Event& e) {
+  std::span<const Event::Word> words = e.GetWords();
+  for (size_t i = 0; i < words.size(); ++i) {
+    if (words[i] != 0) {
+      return i * Event::kWordBits + static_cast<size_t>(std::countr_zero(words[i]));
+    }
+  }
+  return e.GetSpaceSize();
+}
+
+// Измельчение разбиения Ω каждым событием: атом A делится на A ∩ E и A \ E.
+// Возвращает std::nullopt, как только атомов становится больше max_atoms
+std::optional<std::vector<Event>> RefineAtoms(size_t n, std::span<const Event> events, size_t max_atoms) {
+  std::vector<Event> atoms;
+  if (n > 0) {
+    atoms.push_back(Event::Full(n));
+  }
+
+  for (const Event& e : events) {
+    const size_t count = atoms.size();
+    for (size_t i = 0; i < count; ++i) {
+      Event inside = atoms[i] & e;
+      if (inside.IsEmpty()) {
+        continue;
+      }
+      Event outside = atoms[i] - e;
+      if (outside.IsEmpty()) {
+        continue;
+      }
+      atoms[i] = std::move(inside);
+      atoms.push_back(std::move(outside));
+      if (atoms.size() > max_atoms) {
+        return std::nullopt;
+      }
+    }
+  }
+
+  std::ranges::sort(atoms, {}, FirstOutcome);
+  return atoms;
+}
+
+} // namespace
+
+SigmaAlgebra::SigmaAlgebra(const OutcomeSpace& omega, std::vector<Event> events) :
+    omega_(omega),
+    events_(std::move(events)) {
+  index_.reserve(events_.size());
+  for (size_t i = 0; i < events_.size(); ++i) {
+    const size_t hash = events_[i].Hash();
+    auto [begin, end] = index_.equal_range(hash);
+    if (std::none_of(begin, end, [&](const auto& entry) { return events_[entry.second] == events_[i]; })) {
+      index_.emplace(hash, i);
+    }
+  }
+}
+
+SigmaAlgebra::SigmaAlgebra(const OutcomeSpace& omega,
+                           std::vector<Event> atoms,
+                           std::pmr::memory_resource* resource) :
+    omega_(omega),
+    generated_(true),
+    atoms_(std::move(atoms)),
+    lazy_events_(std::make_shared<LazyEvents>()),
+    resource_(resource) {
+}
+
+const OutcomeSpace& SigmaAlgebra::GetOutcomeSpace() const noexcept {
+  return omega_;
+}
+
+const std::vector<Event>& SigmaAlgebra::GetEvents() const {
+  if (!generated_) {
+    return events_;
+  }
+  if (atoms_.size() > kMaxMaterializedAtoms) {
+    throw std::length_error("Sigma-algebra has too many atoms to enumerate its events");
+  }
+
+  std::call_once(lazy_events_->once, [this] {
+    // events[i] = events[i без младшего бита] ∪ атом младшего бита
+    std::vector<Event>& events = lazy_events_->events;
+    const size_t count = size_t{1} << atoms_.size();
+    events.reserve(count);
+    events.push_back(Event::Empty(omega_.GetSize(), resource_));
+    for (size_t i = 1; i < count; ++i) {
+      Event event(events[i & (i - 1)], resource_);
+      event |= atoms_[static_cast<size_t>(std::countr_zero(i))];
+      events.push_back(std::move(event));
+    }
+  });
+  return lazy_events_->events;
+}
+
+bool SigmaAlgebra::IsSigmaAlgebra() const {
+  if (generated_) {
+    return true;
+  }
+  return IsSigmaAlgebra(events_.size() < kParallelThreshold ? 1 : 0);
+}
+
+bool SigmaAlgebra::IsSigmaAlgebra(size_t num_threads) const {
+  if (generated_) {
+    return true;
+  }
+  if (events_.empty()) {
+    return false;
+  }
+
+  const size_t n = omega_.GetSize();
+  if (std::ranges::any_of(events_, [n](const Event& e) { return e.GetSpaceSize() != n; })) {
+    return false;
+  }
+
+  // Алгебра с k атомами содержит ровно 2^k различных событий
+  const size_t distinct = index_.size();
+  if (!std::has_single_bit(distinct) || !Contains(Event::Full(n))) {
+    return false;
+  }
+  const auto expected_atoms = static_cast<size_t>(std::countr_zero(distinct));
+
+  num_threads = ResolveThreadCount(num_threads, events_.size());
+
+  // Быстрый отсев: дополнение каждого события ищется по индексу
+  std::atomic<bool> closed{true};
+  ParallelFor(events_.size(), num_threads, num_threads, [&](size_t /*chunk*/, size_t begin, size_t end) {
+    for (size_t i = begin; i < end && closed.load(std::memory_order_relaxed); ++i) {
+      if (!Contains(~events_[i])) {
+        closed.store(false, std::memory_order_relaxed);
+      }
+    }
+  });
+  if (!closed.load()) {
+    return false;
+  }
+
+  // Каждый поток измельчает Ω своей частью событий, затем разбиения сливаются.
+  // Все события - объединения общих атомов, поэтому 2^k различных событий бывает
+  // только тогда, когда в наборе есть все объединения, т.е. он замкнут
+  std::vector<std::optional<std::vector<Event>>> partial(num_threads);
+  std::span<const Event> events(events_);
+  ParallelFor(events_.size(), num_threads, num_threads, [&](size_t chunk, size_t begin, size_t end) {
+    partial[chunk] = RefineAtoms(n, events.subspan(begin, end - begin), expected_atoms);
+  });
+
+  std::vector<Event> blocks;
+  for (auto& atoms : partial) {
+    if (!atoms.has_value()) {
+      return false;
+    }
+    std::ranges::move(*atoms, std::back_inserter(blocks));
+  }
+  std::optional<std::vector<Event>> atoms = RefineAtoms(n, blocks, expected_atoms);
+  return atoms.has_value() && atoms->size() == expected_atoms;
+}
+
+bool SigmaAlgebra::Contains(const Event& event) const {
+  if (event.GetSpaceSize() != omega_.GetSize()) {
+    return false;
+  }
+
+  if (generated_) {
+    // Событие лежит в алгебре, если совпадает с объединением атомов, которые оно задевает
+    Event covered = Event::Empty(event.GetSpaceSize());
+    for (const Event& atom : atoms_) {
+      if (event.Contains(FirstOutcome(atom))) {
+        covered |= atom;
+      }
+    }
+    return covered == event;
+  }
+
+  auto [begin, end] = index_.equal_range(event.Hash());
+  return std::any_of(begin, end, [&](const auto& entry) { return events_[entry.second] == event; });
+}
+
+std::vector<Event> SigmaAlgebra::GetAtoms() const {
+  if (generated_) {
+    return atoms_;
+  }
+  return *RefineAtoms(omega_.GetSize(), events_, std::numeric_limits<size_t>::max());
+}
+
+std::uint64_t SigmaAlgebra::GetEventCount() const {
+  if (!generated_) {
+    return events_.size();
+  }
+  if (atoms_.size() >= std::numeric_limits<std::uint64_t>::digits) {
+    throw std::overflow_error("Number of events does not fit into 64 bits");
+  }
+  return std::uint64_t{1} << atoms_.size();
+}
+
+Event SigmaAlgebra::EventAt(std::uint64_t index) const {
+  if (!generated_) {
+    return events_.at(index);
+  }
+  if (index >= GetEventCount()) {
+    throw std::out_of_range("Event index is out of the sigma-algebra");
+  }
+
+  Event result = Event::Empty(omega_.GetSize(), resource_);
+  for (; index != 0; index &= index - 1) {
+    result |= atoms_[static_cast<size_t>(std::countr_zero(index))];
+  }
+  return result;
+}
+
+SigmaAlgebra SigmaAlgebra::Generate(const OutcomeSpace& omega,
+                                    const std::vector<Event>& generators,
+                                    std::pmr::memory_resource* resource) {
+  const size_t n = omega.GetSize();
+  constexpr size_t kNoLabel = std::numeric_limits<size_t>::max();
+
+  // labels[i] - номер атома исхода i. Каждый генератор делит атом надвое, новые номера
+  // раздаются в порядке первого исхода, так что атомы сразу упорядочены
+  std::vector<size_t> labels(n, 0);
+  size_t atom_count = n > 0 ? 1 : 0;
+  std::vector<size_t> remap;
+  for (const Event& g : generators) {
+    if (g.GetSpaceSize() != n) {
+      throw std::invalid_argument("Generator is defined over a different outcome space");
+    }
+
+    remap.assign(2 * atom_count, kNoLabel);
+    size_t next = 0;
+    for (size_t i = 0; i < n; ++i) {
+      size_t& label = remap[2 * labels[i] + static_cast<size_t>(g.Contains(i))];
+      if (label == kNoLabel) {
+        label = next++;
+      }
+      labels[i] = label;
+    }
+    atom_count = next;
+  }
+
+  // Без копирования: копия Event ушла бы в ресурс по умолчанию
+  std::vector<Event> atoms;
+  atoms.reserve(atom_count);
+  for (size_t i = 0; i < atom_count; ++i) {
+    atoms.push_back(Event::Empty(n, resource));
+  }
+  for (size_t i = 0; i < n; ++i) {
+    atoms[labels[i]].Insert(i);
+  }
+  return {omega, std::move(atoms), resource};
+}
+
+} // namespace ptm
@@ -1,6 +1,13 @@
 #ifndef PTM_SIGMAALGEBRA_HPP_
 #define PTM_SIGMAALGEBRA_HPP_
 
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 #include "Event.hpp"
 #include "OutcomeSpace.hpp"
 
@@ -11,16 +18,50 @@ public:
   SigmaAlgebra(const OutcomeSpace& omega, std::vector<Event> events);
 
   [[nodiscard]] const OutcomeSpace& GetOutcomeSpace() const noexcept;
-  [[nodiscard]] const std::vector<Event>& GetEvents() const noexcept;
+
+  // У сгенерированной алгебры все 2^k событий перечисляются при первом обращении, один раз
+  // даже при одновременных вызовах из нескольких потоков
+  [[nodiscard]] const std::vector<Event>& GetEvents() const;
 
   [[nodiscard]] bool IsSigmaAlgebra() const;
+  // Проверка, распределённая по num_threads потокам; 0 - по числу ядер
+  [[nodiscard]] bool IsSigmaAlgebra(size_t num_threads) const;
+
+  // Принадлежность события набору: поиск по хэшу маски, без перебора
+  [[nodiscard]] bool Contains(const Event& event) const;
+
+  // Атомы - разбиение Ω, порождённое событиями, упорядоченное по первому исходу
+  [[nodiscard]] std::vector<Event> GetAtoms() const;
 
-  // Построение сигма-алгебры из множества генераторов
-  static SigmaAlgebra Generate(const OutcomeSpace& omega, const std::vector<Event>& generators);
+  // Число событий; для сгенерированной алгебры 2^k без перечисления
+  [[nodiscard]] std::uint64_t GetEventCount() const;
+
+  // index-е событие; для сгенерированной алгебры - объединение атомов, отмеченных битами index
+  [[nodiscard]] Event EventAt(std::uint64_t index) const;
+
+  // Построение сигма-алгебры из множества генераторов. Маски атомов и событий, которые
+  // алгебра строит из них (GetEvents, EventAt), выделяются из resource
+  static SigmaAlgebra Generate(const OutcomeSpace& omega,
+                               const std::vector<Event>& generators,
+                               std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
 private:
   const OutcomeSpace& omega_;
+  // Для сгенерированной алгебры хранятся только атомы
+  bool generated_ = false;
+  std::vector<Event> atoms_;
   std::vector<Event> events_;
+  // События сгенерированной алгебры, перечисленные под call_once. Копии алгебры делят один список
+  struct LazyEvents {
+    std::once_flag once;
+    std::vector<Event> events;
+  };
+  std::shared_ptr<LazyEvents> lazy_events_;
+  // Хэш маски -> позиция в events_, только для различных событий явного набора
+  std::unordered_multimap<size_t, size_t> index_;
+  std::pmr::memory_resource* resource_ = std::pmr::get_default_resource();
+
+  SigmaAlgebra(const OutcomeSpace& omega, std::vector<Event> atoms, std::pmr::memory_resource* resource);
 };
 
 } // namespace ptm
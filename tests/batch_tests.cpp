@@ -0,0 +1,209 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "bin/BatchRunner.hpp"
+#include "bin/JobSpec.hpp"
+#include "bin/ResultWriter.hpp"
+
+namespace {
+
+struct ParsedRow {
+  std::uint64_t job = 0;
+  std::uint64_t repeat = 0;
+  std::string kind;
+  std::string metric;
+  std::uint64_t index = 0;
+  double value = 0.0;
+};
+
+std::vector<std::string> SortedLines(const std::string& text) {
+  std::vector<std::string> lines;
+  std::istringstream in(text);
+  for (std::string line; std::getline(in, line);) {
+    lines.push_back(line);
+  }
+  std::sort(lines.begin(), lines.end());
+  return lines;
+}
+
+std::vector<ParsedRow> ReadCsv(const std::string& text) {
+  std::istringstream in(text);
+  std::string line;
+  std::getline(in, line);
+  EXPECT_EQ(line, "job,repeat,kind,metric,index,value");
+
+  std::vector<ParsedRow> rows;
+  while (std::getline(in, line)) {
+    std::istringstream fields(line);
+    std::string job;
+    std::string repeat;
+    std::string index;
+    std::string value;
+    ParsedRow row;
+    std::getline(fields, job, ',');
+    std::getline(fields, repeat, ',');
+    std::getline(fields, row.kind, ',');
+    std::getline(fields, row.metric, ',');
+    std::getline(fields, index, ',');
+    std::getline(fields, value);
+    row.job = std::stoull(job);
+    row.repeat = std::stoull(repeat);
+    row.index = std::stoull(index);
+    row.value = std::stod(value);
+    rows.push_back(row);
+  }
+  return rows;
+}
+
+template <typename T>
+T ReadRaw(std::istream& in) {
+  T value{};
+  in.read(reinterpret_cast<char*>(&value), sizeof(value)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+  return value;
+}
+
+std::string ReadShortString(std::istream& in) {
+  std::string s(ReadRaw<std::uint8_t>(in), '\0');
+  in.read(s.data(), static_cast<std::streamsize>(s.size()));
+  return s;
+}
+
+std::vector<ParsedRow> ReadBinary(const std::string& bytes) {
+  std::istringstream in(bytes);
+  char magic[4] = {};
+  in.read(magic, 4);
+  EXPECT_EQ(std::string(magic, 4), "PTMR");
+  EXPECT_EQ(ReadRaw<std::uint32_t>(in), ptm::BinaryResultWriter::kVersion);
+
+  std::vector<ParsedRow> rows;
+  while (in.peek() != std::char_traits<char>::eof()) {
+    ParsedRow row;
+    row.job = ReadRaw<std::uint64_t>(in);
+    row.repeat = ReadRaw<std::uint64_t>(in);
+    row.index = ReadRaw<std::uint64_t>(in);
+    row.value = ReadRaw<double>(in);
+    row.kind = ReadShortString(in);
+    row.metric = ReadShortString(in);
+    rows.push_back(row);
+  }
+  return rows;
+}
+
+} // namespace
+
+TEST(JobSpecTest, ParsesJobFile) {
+  using namespace ptm;
+
+  std::istringstream in(
+      "# комментарий\n"
+      "\n"
+      "experiment normal samples=1000 repeats=3 mean=1 stddev=2\n"
+      "lln poisson max_n=500 step=50 lambda=4\n"
+      "markov corpus.txt level=char\n");
+  const std::vector<JobSpec> jobs = ParseJobSpecs(in, "data");
+
+  ASSERT_EQ(jobs.size(), 3u);
+  EXPECT_EQ(jobs[0].kind, JobKind::Experiment);
+  EXPECT_EQ(jobs[0].line, 3u);
+  EXPECT_EQ(jobs[0].target, "normal");
+  EXPECT_EQ(jobs[0].Count("samples"), 1000u);
+  EXPECT_EQ(jobs[0].Count("repeats", 1), 3u);
+  EXPECT_DOUBLE_EQ(jobs[0].Number("stddev"), 2.0);
+  EXPECT_DOUBLE_EQ(MakeDistribution(jobs[0])->TheoreticalMean(), 1.0);
+
+  EXPECT_EQ(jobs[1].kind, JobKind::LawOfLargeNumbers);
+  EXPECT_EQ(jobs[1].Count("repeats", 1), 1u);
+  EXPECT_EQ(jobs[2].kind, JobKind::MarkovCorpus);
+  EXPECT_EQ(jobs[2].target, (std::filesystem::path("data") / "corpus.txt").string());
+  EXPECT_EQ(jobs[2].Text("level", "word"), "char");
+
+  auto parse = [](const std::string& text) {
+    std::istringstream job(text);
+    return ParseJobSpecs(job);
+  };
+  EXPECT_THROW(parse("simulate normal samples=10 mean=0 stddev=1\n"), std::invalid_argument);
+  EXPECT_THROW(parse("experiment normal samples\n"), std::invalid_argument);
+  EXPECT_THROW(parse("experiment gamma samples=10\n"), std::invalid_argument);
+  EXPECT_THROW(parse("experiment normal samples=10 mean=x stddev=1\n"), std::invalid_argument);
+
+  // Параметры запуска проверяются при разборе, а не в потоке пула
+  EXPECT_THROW(parse("experiment normal mean=0 stddev=1\n"), std::invalid_argument);
+  EXPECT_THROW(parse("experiment normal samples=0 mean=0 stddev=1\n"), std::invalid_argument);
+  EXPECT_THROW(parse("experiment normal samples=10 repeats=-1 mean=0 stddev=1\n"), std::invalid_argument);
+  EXPECT_THROW(parse("lln normal step=10 mean=0 stddev=1\n"), std::invalid_argument);
+  EXPECT_THROW(parse("lln normal max_n=100 step=0 mean=0 stddev=1\n"), std::invalid_argument);
+  EXPECT_THROW(parse("markov corpus.txt level=sentence\n"), std::invalid_argument);
+  EXPECT_THROW(parse("experiment binomial samples=10 n=4294967296 p=0.5\n"), std::invalid_argument);
+  EXPECT_NO_THROW(parse("experiment binomial samples=10 n=4294967295 p=0.5\n"));
+}
+
+TEST(BatchRunnerTest, JobSeedsAreDeterministic) {
+  using namespace ptm;
+
+  auto first_values = [](std::mt19937 rng) {
+    std::vector<std::uint32_t> values(4);
+    for (auto& v : values) {
+      v = rng();
+    }
+    return values;
+  };
+  EXPECT_EQ(first_values(MakeJobRng(42, 1, 2)), first_values(MakeJobRng(42, 1, 2)));
+  EXPECT_NE(first_values(MakeJobRng(42, 1, 2)), first_values(MakeJobRng(42, 1, 3)));
+  EXPECT_NE(first_values(MakeJobRng(42, 1, 2)), first_values(MakeJobRng(42, 2, 2)));
+  EXPECT_NE(first_values(MakeJobRng(42, 1, 2)), first_values(MakeJobRng(43, 1, 2)));
+
+  std::istringstream in(
+      "experiment normal samples=2000 repeats=3 mean=0 stddev=1\n"
+      "experiment poisson samples=2000 repeats=2 lambda=3\n"
+      "lln uniform max_n=1000 step=100 repeats=2 a=0 b=1\n");
+  const std::vector<JobSpec> jobs = ParseJobSpecs(in);
+
+  // Порядок строк зависит от расписания, набор строк - нет
+  auto run = [&jobs](std::size_t num_threads) {
+    std::ostringstream out;
+    CsvResultWriter writer(out);
+    RunBatch(jobs, writer, BatchOptions{.num_threads = num_threads, .seed = 7});
+    return SortedLines(out.str());
+  };
+  const std::vector<std::string> sequential = run(1);
+  EXPECT_EQ(sequential.size(), 1 + 3 * 4 + 2 * 4 + 2 * 10 * 2);
+  EXPECT_EQ(run(4), sequential);
+}
+
+TEST(ResultWriterTest, CsvAndBinaryRoundTrip) {
+  using namespace ptm;
+
+  const ResultRow rows[] = {
+      {0, 0, "experiment", "mean", 0, 0.1},
+      {1, 3, "lln", "abs_error", 1000, -1.0 / 3.0},
+      {2, 0, "markov", "perplexity", 0, std::numeric_limits<double>::max()},
+  };
+
+  std::ostringstream csv;
+  std::ostringstream binary;
+  {
+    CsvResultWriter csv_writer(csv);
+    BinaryResultWriter binary_writer(binary);
+    csv_writer.Write(rows);
+    binary_writer.Write(rows);
+  }
+
+  for (const std::vector<ParsedRow>& parsed : {ReadCsv(csv.str()), ReadBinary(binary.str())}) {
+    ASSERT_EQ(parsed.size(), std::size(rows));
+    for (std::size_t i = 0; i < parsed.size(); ++i) {
+      EXPECT_EQ(parsed[i].job, rows[i].job);
+      EXPECT_EQ(parsed[i].repeat, rows[i].repeat);
+      EXPECT_EQ(parsed[i].kind, rows[i].kind);
+      EXPECT_EQ(parsed[i].metric, rows[i].metric);
+      EXPECT_EQ(parsed[i].index, rows[i].index);
+      // max_digits10 в CSV и сырые байты в бинарном формате сохраняют значение точно
+      EXPECT_EQ(parsed[i].value, rows[i].value);
+    }
+  }
+}
@@ -1,15 +1,24 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <thread>
+#include <vector>
 
 #include "lib/distributions/BernoulliDistribution.hpp"
 #include "lib/distributions/BinomialDistribution.hpp"
 #include "lib/distributions/CauchyDistribution.hpp"
+#include "lib/distributions/DiscreteQuantileTable.hpp"
 #include "lib/distributions/DistributionExperiment.hpp"
+#include "lib/distributions/ExponentialDistribution.hpp"
 #include "lib/distributions/GeometricDistribution.hpp"
 #include "lib/distributions/LaplaceDistribution.hpp"
 #include "lib/distributions/NormalDistribution.hpp"
+#include "lib/distributions/ParameterSweep.hpp"
 #include "lib/distributions/PoissonDistribution.hpp"
+#include "lib/distributions/QuantileSketch.hpp"
+#include "lib/distributions/SpecialFunctions.hpp"
 #include "lib/distributions/UniformDistribution.hpp"
 
 TEST(DistributionTest, NormalDistributionBasicProperties) {
@@ -133,4 +142,290 @@ TEST(DistributionExperimentTest, BinomialEmpiricalMean) {
   EXPECT_NEAR(stats.empirical_variance, dist->TheoreticalVariance(), 0.5);
 }
 
+TEST(DistributionExperimentTest, BootstrapIntervalsCoverTruth) {
+  using namespace ptm;
+
+  auto dist = std::make_shared<NormalDistribution>(1.0, 2.0);
+  DistributionExperiment experiment(dist, 4000);
+
+  std::mt19937 rng(2024);
+  BootstrapResult result = experiment.Bootstrap(rng, 400, 0.95, ResamplingScheme::Multinomial, 4);
+  EXPECT_EQ(result.num_resamples, 400u);
+
+  for (const BootstrapEstimate* e : {&result.mean, &result.variance}) {
+    EXPECT_LT(e->percentile.lower, e->estimate);
+    EXPECT_GT(e->percentile.upper, e->estimate);
+  }
+  // Повторы sup-статистики смещены вверх, оценка может лежать левее процентильного интервала
+  for (const BootstrapEstimate* e : {&result.mean, &result.variance, &result.kolmogorov_distance}) {
+    EXPECT_LT(e->percentile.lower, e->percentile.upper);
+    EXPECT_LE(e->bca.lower, e->bca.upper);
+    EXPECT_GT(e->standard_error, 0.0);
+  }
+  EXPECT_LT(result.mean.bca.lower, 1.0);
+  EXPECT_GT(result.mean.bca.upper, 1.0);
+  EXPECT_LT(result.variance.bca.lower, 4.0);
+  EXPECT_GT(result.variance.bca.upper, 4.0);
+  // Стандартная ошибка среднего ≈ σ / √n
+  EXPECT_NEAR(result.mean.standard_error, 2.0 / std::sqrt(4000.0), 0.005);
+
+  // Повторы сидируются по номеру, поэтому число потоков не влияет на результат
+  std::mt19937 rng_single(2024);
+  BootstrapResult single = experiment.Bootstrap(rng_single, 400, 0.95, ResamplingScheme::Multinomial, 1);
+  EXPECT_DOUBLE_EQ(single.mean.bca.lower, result.mean.bca.lower);
+  EXPECT_DOUBLE_EQ(single.kolmogorov_distance.percentile.upper, result.kolmogorov_distance.percentile.upper);
+
+  std::mt19937 rng_poisson(2024);
+  BootstrapResult poisson = experiment.Bootstrap(rng_poisson, 400, 0.9, ResamplingScheme::Poisson);
+  EXPECT_NEAR(poisson.mean.standard_error, result.mean.standard_error, 0.01);
+
+  EXPECT_THROW((void)experiment.Bootstrap(rng, 0), std::invalid_argument);
+  EXPECT_THROW((void)experiment.Bootstrap(rng, 10, 1.5), std::invalid_argument);
+  DistributionExperiment tiny(dist, 1);
+  EXPECT_THROW((void)tiny.Bootstrap(rng, 10), std::invalid_argument);
+  // Размер проверяется до того, как выборка создана
+  DistributionExperiment huge(dist, std::size_t{1} << 32);
+  EXPECT_THROW((void)huge.Bootstrap(rng, 10), std::length_error);
+}
+
+TEST(DistributionExperimentTest, BootstrapKolmogorovDistanceIsTwoSided) {
+  using namespace ptm;
+
+  auto dist = std::make_shared<UniformDistribution>(0.0, 1.0);
+  const std::size_t n = 20;
+  DistributionExperiment experiment(dist, n);
+
+  // Bootstrap берёт выборку первыми n значениями генератора. Несколько зёрен, чтобы максимум
+  // попадал и на уровень до скачка ECDF, и на уровень после
+  for (std::uint32_t seed = 1; seed <= 8; ++seed) {
+    std::mt19937 rng(seed);
+    std::mt19937 replay(seed);
+    std::vector<double> values(n);
+    for (double& x : values) {
+      x = dist->Sample(replay);
+    }
+    std::ranges::sort(values);
+
+    double expected = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+      const double cdf = dist->Cdf(values[i]);
+      expected = std::max({expected,
+                           cdf - static_cast<double>(i) / static_cast<double>(n),
+                           static_cast<double>(i + 1) / static_cast<double>(n) - cdf});
+    }
+
+    BootstrapResult result = experiment.Bootstrap(rng, 50);
+    EXPECT_NEAR(result.kolmogorov_distance.estimate, expected, 1e-12) << "seed " << seed;
+  }
+}
+
+TEST(SpecialFunctionsTest, ClosedFormDiscreteCdfMatchesSummation) {
+  using namespace ptm;
+
+  EXPECT_NEAR(LogFactorial(10), std::log(3628800.0), 1e-12);
+  EXPECT_NEAR(LogFactorial(5000), std::lgamma(5001.0), 1e-9);
+  EXPECT_NEAR(LogGamma(0.5), 0.5 * std::log(std::numbers::pi), 1e-13);
+  EXPECT_NEAR(RegularizedIncompleteBeta(2.0, 3.0, 0.4), 0.5248, 1e-12);
+  EXPECT_NEAR(RegularizedGammaP(1.0, 2.0), 1.0 - std::exp(-2.0), 1e-14);
+  EXPECT_NEAR(StandardNormalQuantile(StandardNormalCdf(1.3)), 1.3, 1e-12);
+
+  // Суммирование вероятностей в long double - эталон для умеренных параметров
+  BinomialDistribution binomial(60, 0.35);
+  PoissonDistribution poisson(25.0);
+  long double binomial_sum = 0.0L;
+  long double poisson_sum = 0.0L;
+  for (int k = 0; k <= 60; ++k) {
+    binomial_sum += binomial.Pdf(k);
+    poisson_sum += poisson.Pdf(k);
+    EXPECT_NEAR(binomial.Cdf(k), static_cast<double>(binomial_sum), 1e-13);
+    EXPECT_NEAR(poisson.Cdf(k), static_cast<double>(poisson_sum), 1e-13);
+  }
+  EXPECT_NEAR(binomial.Cdf(20.5), binomial.Cdf(20.0), 0.0);
+
+  // n, λ ~ 10^6: по нормальному приближению в среднем около 1/2 и монотонность
+  BinomialDistribution big_binomial(2000000, 0.5);
+  PoissonDistribution big_poisson(1e6);
+  EXPECT_NEAR(big_binomial.Cdf(1000000.0), 0.5 + big_binomial.Pdf(1000000.0) / 2.0, 1e-9);
+  EXPECT_NEAR(big_poisson.Cdf(1e6 + 1000.0), StandardNormalCdf(1000.5 / 1000.0), 1e-3);
+  EXPECT_NEAR(big_poisson.Cdf(1e6) - big_poisson.Cdf(1e6 - 1.0), big_poisson.Pdf(1e6), 1e-12);
+}
+
+TEST(DistributionTest, QuantileInvertsCdf) {
+  using namespace ptm;
+
+  std::vector<std::shared_ptr<Distribution>> continuous = {
+      std::make_shared<NormalDistribution>(1.0, 2.0), std::make_shared<UniformDistribution>(-1.0, 3.0),
+      std::make_shared<ExponentialDistribution>(0.5),  std::make_shared<CauchyDistribution>(0.0, 2.0),
+      std::make_shared<LaplaceDistribution>(1.0, 0.5),
+  };
+  std::vector<std::shared_ptr<Distribution>> discrete = {
+      std::make_shared<BernoulliDistribution>(0.3), std::make_shared<BinomialDistribution>(1000, 0.2),
+      std::make_shared<GeometricDistribution>(0.1), std::make_shared<PoissonDistribution>(1e5),
+  };
+
+  for (double u : {1e-6, 0.01, 0.3, 0.5, 0.77, 0.999}) {
+    for (const auto& dist : continuous) {
+      EXPECT_NEAR(dist->Cdf(dist->Quantile(u)), u, 1e-9);
+    }
+    // Наименьшее k с F(k) >= u
+    for (const auto& dist : discrete) {
+      const double k = dist->Quantile(u);
+      EXPECT_EQ(k, std::floor(k));
+      EXPECT_GE(dist->Cdf(k), u);
+      EXPECT_LT(dist->Cdf(k - 1.0), u);
+    }
+  }
+
+  // Бисекция по умолчанию даёт то же, что явная формула
+  class BisectedNormal : public NormalDistribution {
+  public:
+    using NormalDistribution::NormalDistribution;
+    [[nodiscard]] double Quantile(double u) const override {
+      return Distribution::Quantile(u); // NOLINT(bugprone-parent-virtual-call)
+    }
+  };
+  BisectedNormal bisected(1.0, 2.0);
+  EXPECT_NEAR(bisected.Quantile(0.975), 1.0 + 2.0 * 1.959963984540054, 1e-9);
+  EXPECT_THROW((void)bisected.Quantile(1.5), std::invalid_argument);
+}
+
+TEST(DistributionTest, DiscreteQuantileTableMatchesExactSearch) {
+  using namespace ptm;
+
+  std::vector<std::shared_ptr<Distribution>> discrete = {
+      std::make_shared<PoissonDistribution>(0.5),         std::make_shared<PoissonDistribution>(4.0),
+      std::make_shared<PoissonDistribution>(1e3),         std::make_shared<PoissonDistribution>(1e5),
+      std::make_shared<PoissonDistribution>(1e9),         std::make_shared<BinomialDistribution>(1000, 0.2),
+      std::make_shared<BinomialDistribution>(30, 0.97),   std::make_shared<BinomialDistribution>(1, 0.5),
+      std::make_shared<BinomialDistribution>(10, 1.0),
+  };
+
+  for (const auto& dist : discrete) {
+    std::vector<double> levels;
+    for (int i = 1; i < 200; ++i) {
+      levels.push_back(i / 200.0);
+    }
+    // Уровни ровно на ступеньках F и рядом с ними: здесь таблица уступает точному поиску
+    const double median = dist->Quantile(0.5);
+    for (double k : {median - 1.0, median, median + 1.0}) {
+      const double step = dist->Cdf(k);
+      levels.insert(levels.end(), {step, std::nextafter(step, 0.0), std::nextafter(step, 1.0)});
+    }
+
+    for (double u : levels) {
+      if (u <= 0.0 || u >= 1.0) {
+        continue;
+      }
+      const double k = dist->Quantile(u);
+      EXPECT_GE(dist->Cdf(k), u);
+      EXPECT_LT(dist->Cdf(k - 1.0), u);
+    }
+  }
+
+  // Носитель шире kMaxSize точек - таблица пустая, Quantile идёт точным поиском
+  auto wide = DiscreteQuantileTable::Around(
+      0.0, 1e-6, 0.0, 1e9, [](double) { return 1.0; }, [](double) { return 0.0; });
+  EXPECT_TRUE(wide.IsEmpty());
+  EXPECT_FALSE(wide.Find(0.5).has_value());
+
+  // Равномерное на {3, ..., 6}: F = 1/4, 1/2, 3/4, 1
+  auto uniform = DiscreteQuantileTable::Around(
+      3.0, 0.25, 3.0, 6.0, [](double) { return 1.0; }, [](double) { return 0.0; });
+  EXPECT_FALSE(uniform.IsEmpty());
+  EXPECT_EQ(uniform.Find(0.1), 3.0);
+  EXPECT_EQ(uniform.Find(0.6), 5.0);
+  EXPECT_FALSE(uniform.Find(0.5).has_value());
+  EXPECT_FALSE(uniform.Find(0.99999999999).has_value());
+}
+
+TEST(ParameterSweepTest, CommonRandomNumbersAcrossGrid) {
+  using namespace ptm;
+
+  std::vector<double> sigmas;
+  for (int i = 1; i <= 16; ++i) {
+    sigmas.push_back(0.25 * i);
+  }
+  ParameterSweep sweep =
+      ParameterSweep::Over(sigmas, [](double s) { return std::make_shared<NormalDistribution>(0.0, s); }, 50000);
+  EXPECT_EQ(sweep.GetGridSize(), sigmas.size());
+
+  std::mt19937 rng(11);
+  std::vector<ExperimentStats> stats = sweep.Run(rng, 3);
+  ASSERT_EQ(stats.size(), sigmas.size());
+
+  // Одни и те же u_i: выборка N(0, σ) - это выборка N(0, 1), умноженная на σ
+  const double base_mean = stats[3].empirical_mean / sigmas[3];
+  const double base_variance = stats[3].empirical_variance / (sigmas[3] * sigmas[3]);
+  for (size_t i = 0; i < sigmas.size(); ++i) {
+    EXPECT_NEAR(stats[i].empirical_mean, sigmas[i] * base_mean, 1e-12);
+    EXPECT_NEAR(stats[i].empirical_variance, sigmas[i] * sigmas[i] * base_variance, 1e-9);
+    EXPECT_LT(stats[i].variance_error / (sigmas[i] * sigmas[i]), 0.05);
+  }
+
+  std::mt19937 rng_single(11);
+  std::vector<ExperimentStats> single = sweep.Run(rng_single, 1);
+  EXPECT_DOUBLE_EQ(single.back().empirical_mean, stats.back().empirical_mean);
+
+  std::mt19937 rng_poisson(3);
+  ParameterSweep poisson = ParameterSweep::Over(
+      {0.5, 4.0, 40.0}, [](double l) { return std::make_shared<PoissonDistribution>(l); }, 20000);
+  for (const ExperimentStats& s : poisson.Run(rng_poisson)) {
+    EXPECT_LT(s.mean_error, 0.2);
+  }
+
+  auto normal = std::make_shared<NormalDistribution>(0.0, 1.0);
+  EXPECT_THROW(ParameterSweep({normal}, 0), std::invalid_argument);
+  EXPECT_THROW(ParameterSweep({normal, nullptr}, 10), std::invalid_argument);
+}
+
+TEST(QuantileSketchTest, MergedThreadSketchesTrackDistribution) {
+  using namespace ptm;
+
+  auto dist = std::make_shared<NormalDistribution>(0.0, 1.0);
+  constexpr size_t kThreads = 4;
+  constexpr size_t kPerThread = 100000;
+
+  // Каждый поток - свой генератор и свой скетч, затем слияние
+  std::vector<QuantileSketch> sketches;
+  for (size_t t = 0; t < kThreads; ++t) {
+    sketches.emplace_back(QuantileSketch::kDefaultK, t);
+  }
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      std::mt19937 rng(static_cast<std::uint32_t>(100 + t));
+      DistributionExperiment experiment(dist, kPerThread);
+      (void)experiment.Run(rng, sketches[t]);
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  QuantileSketch merged(QuantileSketch::kDefaultK, kThreads);
+  for (const auto& sketch : sketches) {
+    merged.Merge(sketch);
+  }
+  EXPECT_EQ(merged.GetCount(), kThreads * kPerThread);
+  EXPECT_LT(merged.GetRetainedCount(), 2000u);
+
+  const double eps = merged.RankErrorBound();
+  for (double q : {0.01, 0.1, 0.5, 0.9, 0.99}) {
+    EXPECT_NEAR(dist->Cdf(merged.Quantile(q)), q, eps + 0.005);
+  }
+  for (double x : {-2.0, -0.5, 0.0, 1.0, 2.5}) {
+    EXPECT_NEAR(merged.Cdf(x), dist->Cdf(x), eps + 0.005);
+  }
+  EXPECT_DOUBLE_EQ(merged.Quantile(0.0), merged.GetMin());
+  EXPECT_DOUBLE_EQ(merged.Quantile(1.0), merged.GetMax());
+
+  DistributionExperiment experiment(dist, 0);
+  EXPECT_LT(experiment.KolmogorovDistance(merged), eps + 0.01);
+  DistributionExperiment shifted(std::make_shared<NormalDistribution>(0.5, 1.0), 0);
+  EXPECT_GT(shifted.KolmogorovDistance(merged), 0.15);
+
+  EXPECT_THROW(merged.Merge(QuantileSketch(50, 0)), std::invalid_argument);
+  EXPECT_THROW((void)merged.Quantile(1.5), std::invalid_argument);
+}
+
 // Add your tests...
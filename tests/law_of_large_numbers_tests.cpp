@@ -36,4 +36,19 @@ TEST(LawOfLargeNumbersTest, BernoulliMeanConverges) {
   }
 }
 
+TEST(LawOfLargeNumbersTest, SimulationFeedsQuantileSketch) {
+  using namespace ptm;
+
+  std::mt19937 rng(5);
+  auto dist = std::make_shared<BernoulliDistribution>(0.3);
+  LawOfLargeNumbersSimulator sim(dist);
+
+  QuantileSketch sketch(QuantileSketch::kDefaultK, 5);
+  LLNPathResult result = sim.Simulate(rng, 20000, 1000, sketch);
+
+  EXPECT_EQ(result.entries.size(), 20u);
+  EXPECT_EQ(sketch.GetCount(), 20000u);
+  EXPECT_NEAR(sketch.Cdf(0.0), 0.7, sketch.RankErrorBound() + 0.02);
+}
+
 // Add your tests...
@@ -1,5 +1,7 @@
 #include <algorithm>
+#include <cmath>
 #include <fstream>
+#include <memory_resource>
 #include <gtest/gtest.h>
 
 #include "lib/markov-chain/MarkovChain.hpp"
@@ -31,6 +33,44 @@ TEST(MarkovChainTest, IncrementalTraining) {
   EXPECT_NEAR(p_ab2, 0.5, 1e-9);
   EXPECT_NEAR(p_ac2, 0.5, 1e-9);
   EXPECT_NEAR(p_ab1, 1.0, 1e-9);
+
+  EXPECT_EQ(chain.StateAt(0), "A");
+  EXPECT_EQ(chain.StateAt(chain.FindState("C")), "C");
+  EXPECT_THROW((void)chain.StateAt(3), std::out_of_range);
+
+  // kUnknownState допустим, прочие индексы за пределами цепи - нет
+  const Smoothing kneser_ney{.kind = SmoothingKind::KneserNey};
+  EXPECT_GT(chain.SmoothedProbability(MarkovChain::kUnknownState, 0, kneser_ney), 0.0);
+  EXPECT_THROW((void)chain.SmoothedProbability(3, 0, kneser_ney), std::out_of_range);
+  EXPECT_THROW((void)chain.SmoothedProbability(0, 3, kneser_ney), std::out_of_range);
+  const std::vector<MarkovChain::StateId> ids = {0, 1, 7};
+  EXPECT_THROW((void)chain.LogLikelihood(ids), std::out_of_range);
+}
+
+TEST(MarkovChainTest, TrainsInsideMonotonicArena) {
+  using namespace ptm;
+
+  const std::string text = "the cat sat on the mat and the cat ran to the long winding road of the town";
+  std::pmr::monotonic_buffer_resource arena;
+  MarkovTextModel arena_model(MarkovTextModel::TokenLevel::Word, &arena);
+  MarkovTextModel model;
+  arena_model.TrainFromText(text);
+  model.TrainFromText(text);
+
+  EXPECT_EQ(arena_model.Chain().GetMemoryResource(), &arena);
+  EXPECT_EQ(arena_model.Chain().States(), model.Chain().States());
+  EXPECT_NEAR(arena_model.Chain().TransitionProbability("the", "cat"), 0.4, 1e-12);
+  EXPECT_EQ(arena_model.Chain().NextDistribution("the"), model.Chain().NextDistribution("the"));
+  EXPECT_DOUBLE_EQ(arena_model.Score("the cat sat").log_likelihood, model.Score("the cat sat").log_likelihood);
+
+  // Перемещение сохраняет ресурс, копия уходит в ресурс по умолчанию
+  MarkovChain chain(&arena);
+  chain.Train({"the", "cat", "the", "mat"});
+  MarkovChain moved = std::move(chain);
+  EXPECT_EQ(moved.GetMemoryResource(), &arena);
+  MarkovChain copy = moved;
+  EXPECT_EQ(copy.GetMemoryResource(), std::pmr::get_default_resource());
+  EXPECT_NEAR(copy.TransitionProbability("the", "cat"), 0.5, 1e-12);
 }
 
 TEST(MarkovTextModelTest, WordLevelGeneration) {
@@ -104,3 +144,57 @@ TEST(MarkovTextModelTest, TrainOnWarAndPeaceWordLevel) {
 }
 
 // Add your tests...
+
+TEST(MarkovTextModelTest, ScoreMatchesTransitionProbabilities) {
+  using namespace ptm;
+
+  MarkovTextModel model(MarkovTextModel::TokenLevel::Word);
+  model.TrainFromText("a b a c a b");
+
+  // P(b|a) = 2/3, P(a|b) = 1
+  auto score = model.Score("a b a", Smoothing{.kind = SmoothingKind::None});
+  EXPECT_EQ(score.num_transitions, 2u);
+  EXPECT_EQ(score.num_unknown_tokens, 0u);
+  EXPECT_NEAR(score.log_likelihood, std::log(2.0 / 3.0), 1e-12);
+  EXPECT_NEAR(score.perplexity, std::exp(-std::log(2.0 / 3.0) / 2.0), 1e-12);
+
+  auto unseen = model.Score("b c", Smoothing{.kind = SmoothingKind::None});
+  EXPECT_TRUE(std::isinf(unseen.log_likelihood));
+}
+
+TEST(MarkovTextModelTest, SmoothedDistributionsSumToOne) {
+  using namespace ptm;
+
+  MarkovTextModel model(MarkovTextModel::TokenLevel::Word);
+  model.TrainFromText("the cat sat on the mat the cat ran");
+  const auto& chain = model.Chain();
+
+  for (auto kind : {SmoothingKind::AddK, SmoothingKind::KneserNey}) {
+    Smoothing smoothing{.kind = kind, .k = 0.5};
+    for (MarkovChain::StateId from = 0; from < chain.GetStateCount(); ++from) {
+      double total = chain.SmoothedProbability(from, MarkovChain::kUnknownState, smoothing);
+      for (MarkovChain::StateId to = 0; to < chain.GetStateCount(); ++to) {
+        total += chain.SmoothedProbability(from, to, smoothing);
+      }
+      EXPECT_NEAR(total, 1.0, 1e-12);
+    }
+  }
+
+  auto score = model.Score("the dog sat", Smoothing{.kind = SmoothingKind::KneserNey});
+  EXPECT_EQ(score.num_unknown_tokens, 1u);
+  EXPECT_TRUE(std::isfinite(score.log_likelihood));
+}
+
+TEST(MarkovTextModelTest, ScoreDocumentsMatchesSequentialScore) {
+  using namespace ptm;
+
+  MarkovTextModel model(MarkovTextModel::TokenLevel::Character);
+  model.TrainFromText("abracadabra");
+
+  std::vector<std::string> documents = {"abra", "cadabra", "", "zzz", "abracadabra"};
+  auto scores = model.ScoreDocuments(documents, {}, 3);
+  ASSERT_EQ(scores.size(), documents.size());
+  for (size_t i = 0; i < documents.size(); ++i) {
+    EXPECT_DOUBLE_EQ(scores[i].log_likelihood, model.Score(documents[i]).log_likelihood);
+  }
+}
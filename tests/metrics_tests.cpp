@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "lib/distributions/NormalDistribution.hpp"
+#include "lib/law-of-large-numbers/LawOfLargeNumbersSimulator.hpp"
+#include "lib/markov-chain/MarkovChain.hpp"
+#include "lib/metrics/CountingMemoryResource.hpp"
+#include "lib/metrics/MetricsRegistry.hpp"
+#include "lib/sigma-algebra/ProbabilityMeasure.hpp"
+
+TEST(MetricsTest, RegistryDumpsJsonAndPrometheus) {
+  using namespace ptm;
+
+  MetricsRegistry registry;
+  registry.Counter("markov_chain.hash_probes").Add(5);
+  registry.Counter("markov_chain.hash_probes").Add(2);
+  registry.Timer("lln.simulate").Record(std::chrono::milliseconds(500), 1000);
+
+  EXPECT_EQ(registry.CounterValue("markov_chain.hash_probes"), 7u);
+  EXPECT_EQ(registry.CounterValue("missing"), 0u);
+  ASSERT_NE(registry.FindTimer("lln.simulate"), nullptr);
+  EXPECT_DOUBLE_EQ(registry.FindTimer("lln.simulate")->ItemsPerSecond(), 2000.0);
+
+  const std::string json = registry.ToJson();
+  EXPECT_NE(json.find("\"markov_chain.hash_probes\":7"), std::string::npos);
+  EXPECT_NE(json.find("\"items_per_second\":2000"), std::string::npos);
+
+  const std::string text = registry.ToPrometheus();
+  EXPECT_NE(text.find("ptm_markov_chain_hash_probes_total 7\n"), std::string::npos);
+  EXPECT_NE(text.find("ptm_lln_simulate_calls_total 1\n"), std::string::npos);
+
+  registry.Reset();
+  EXPECT_EQ(registry.CounterValue("markov_chain.hash_probes"), 0u);
+}
+
+TEST(MetricsTest, InstrumentedSimulatorReportsSamples) {
+  using namespace ptm;
+
+  MetricsRegistry& registry = MetricsRegistry::Global();
+  const std::uint64_t before = registry.CounterValue("lln.samples");
+
+  std::mt19937 rng(7);
+  LawOfLargeNumbersSimulator sim(std::make_shared<NormalDistribution>(0.0, 1.0));
+  (void)sim.Simulate(rng, 1000, 100);
+
+#ifdef PTM_ENABLE_METRICS
+  EXPECT_EQ(registry.CounterValue("lln.samples") - before, 1000u);
+#else
+  // Без PTM_ENABLE_METRICS горячие пути ничего не пишут в реестр
+  EXPECT_EQ(registry.CounterValue("lln.samples"), before);
+#endif
+}
+
+TEST(MetricsTest, HashProbesAndAllocationsAreCountedAtTheirSites) {
+  using namespace ptm;
+
+  MetricsRegistry& registry = MetricsRegistry::Global();
+  const std::uint64_t chain_probes = registry.CounterValue("markov_chain.hash_probes");
+  const std::uint64_t measure_probes = registry.CounterValue("probability_measure.hash_probes");
+  const std::uint64_t allocations = registry.CounterValue("memory.allocations");
+  const std::uint64_t deallocations = registry.CounterValue("memory.deallocations");
+
+  CountingMemoryResource counting;
+  EXPECT_EQ(counting.GetUpstream(), std::pmr::get_default_resource());
+  {
+    MarkovChain chain(&counting);
+    // 4 поиска состояний и 3 вставки новых, 3 поиска перехода в строке, 1 FindState
+    chain.Train(std::vector<std::string>{"a", "b", "a", "c"});
+    EXPECT_EQ(chain.FindState("b"), 1u);
+  }
+
+  OutcomeSpace omega;
+  omega.AddOutcome("heads");
+  omega.AddOutcome("tails");
+  ProbabilityMeasure P(omega);
+  P.SetAtomicProbability(0, 0.5);
+  P.SetAtomicProbability(1, 0.5);
+  P.EnableCache(true);
+  const Event heads({true, false});
+  // Промах кэша - поиск и вставка, попадание - один поиск
+  (void)P.Probability(heads);
+  (void)P.Probability(heads);
+
+#ifdef PTM_ENABLE_METRICS
+  EXPECT_EQ(registry.CounterValue("markov_chain.hash_probes") - chain_probes, 11u);
+  EXPECT_EQ(registry.CounterValue("probability_measure.hash_probes") - measure_probes, 3u);
+  // Цепь разрушена: каждое выделение через обёртку освобождено
+  const std::uint64_t chain_allocations = registry.CounterValue("memory.allocations") - allocations;
+  EXPECT_GT(chain_allocations, 0u);
+  EXPECT_EQ(registry.CounterValue("memory.deallocations") - deallocations, chain_allocations);
+#else
+  EXPECT_EQ(registry.CounterValue("markov_chain.hash_probes"), chain_probes);
+  EXPECT_EQ(registry.CounterValue("probability_measure.hash_probes"), measure_probes);
+  EXPECT_EQ(registry.CounterValue("memory.allocations"), allocations);
+  EXPECT_EQ(registry.CounterValue("memory.deallocations"), deallocations);
+#endif
+}
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "lib/parallel/ParallelFor.hpp"
+#include "lib/parallel/WorkStealingPool.hpp"
+
+TEST(WorkStealingPoolTest, RunsNestedTasksAndWaits) {
+  using namespace ptm;
+
+  WorkStealingPool pool(4);
+  std::atomic<int> sum{0};
+  for (int i = 0; i < 100; ++i) {
+    pool.Submit([&pool, &sum, i] {
+      // Задачи, поставленные из задачи, попадают в очередь того же потока и могут быть украдены
+      for (int j = 0; j < 10; ++j) {
+        pool.Submit([&sum, i] { sum.fetch_add(i); });
+      }
+    });
+  }
+  pool.Wait();
+
+  EXPECT_EQ(sum.load(), 10 * (99 * 100 / 2));
+}
+
+TEST(WorkStealingPoolTest, WaitRethrowsTaskException) {
+  using namespace ptm;
+
+  WorkStealingPool pool(2);
+  std::atomic<int> finished{0};
+  pool.Submit([] { throw std::runtime_error("job failed"); });
+  for (int i = 0; i < 10; ++i) {
+    pool.Submit([&finished] { finished.fetch_add(1); });
+  }
+
+  EXPECT_THROW(pool.Wait(), std::runtime_error);
+  EXPECT_EQ(finished.load(), 10);
+
+  // После ошибки пул продолжает работать
+  pool.Submit([&finished] { finished.fetch_add(1); });
+  EXPECT_NO_THROW(pool.Wait());
+  EXPECT_EQ(finished.load(), 11);
+}
+
+TEST(ParallelForTest, CoversRangeWithContiguousChunks) {
+  using namespace ptm;
+
+  EXPECT_EQ(ResolveThreadCount(3, 10), 3u);
+  EXPECT_EQ(ResolveThreadCount(8, 2), 2u);
+  EXPECT_GE(ResolveThreadCount(0), 1u);
+
+  for (std::size_t num_threads : {1u, 4u}) {
+    const std::size_t count = 1003;
+    std::vector<int> hits(count, 0);
+    std::vector<std::size_t> chunk_sizes(7, 0);
+    ParallelFor(count, 7, num_threads, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+      chunk_sizes[chunk] = end - begin;
+      for (std::size_t i = begin; i < end; ++i) {
+        ++hits[i];
+      }
+    });
+    EXPECT_EQ(std::count(hits.begin(), hits.end(), 1), static_cast<std::ptrdiff_t>(count));
+    for (std::size_t size : chunk_sizes) {
+      EXPECT_TRUE(size == count / 7 || size == count / 7 + 1);
+    }
+  }
+
+  EXPECT_THROW(ParallelFor(10, 10, 2, [](std::size_t chunk, std::size_t, std::size_t) {
+                 if (chunk == 3) {
+                   throw std::runtime_error("chunk failed");
+                 }
+               }),
+               std::runtime_error);
+}
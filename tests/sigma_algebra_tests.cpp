@@ -1,10 +1,14 @@
+#include <cmath>
+#include <memory_resource>
 #include <sstream>
+#include <thread>
 
 #include <gtest/gtest.h>
 #include "lib/sigma-algebra/DiscreteRandomVariable.hpp"
 #include "lib/sigma-algebra/Event.hpp"
 #include "lib/sigma-algebra/OutcomeSpace.hpp"
 #include "lib/sigma-algebra/ProbabilityMeasure.hpp"
+#include "lib/sigma-algebra/ProductProbabilitySpace.hpp"
 #include "lib/sigma-algebra/SigmaAlgebra.hpp"
 
 TEST(SigmaAlgebraTest, ProbabilityMeasureAndExpectation) {
@@ -62,4 +66,535 @@ TEST(SigmaAlgebraTest, EventOperations) {
   EXPECT_FALSE(E3.Contains(c));
 }
 
-// Add your tests...
\ No newline at end of file
+// Add your tests...
+TEST(SigmaAlgebraTest, PackedEventAlgebra) {
+  using namespace ptm;
+
+  // 130 исходов - маска занимает три слова и хвост последнего слова не пуст
+  const size_t n = 130;
+  std::vector<bool> even(n, false);
+  std::vector<bool> low(n, false);
+  for (size_t i = 0; i < n; ++i) {
+    even[i] = i % 2 == 0;
+    low[i] = i < 70;
+  }
+  Event A(even);
+  Event B(low);
+
+  EXPECT_EQ(A.GetSize(), 65u);
+  EXPECT_EQ(B.GetSize(), 70u);
+  EXPECT_EQ((A | B).GetSize(), 100u);
+  EXPECT_EQ((A & B).GetSize(), 35u);
+  EXPECT_EQ((A - B).GetSize(), 30u);
+  EXPECT_EQ((A ^ B).GetSize(), 65u);
+  EXPECT_EQ((~A).GetSize(), 65u);
+  EXPECT_EQ(Event::Full(n).GetSize(), n);
+  EXPECT_TRUE((A & ~A).IsEmpty());
+  EXPECT_EQ(A | ~A, Event::Full(n));
+  EXPECT_EQ(Event::Unite(A, B), A | B);
+  EXPECT_EQ(Event::Intersect(A, B).GetMask().size(), n);
+
+  Event C = A;
+  C -= B;
+  C |= B;
+  EXPECT_EQ(C, A | B);
+  EXPECT_FALSE(C.Contains(n));
+
+  EXPECT_THROW(A |= Event::Full(n + 1), std::invalid_argument);
+}
+
+TEST(SigmaAlgebraTest, LargeEventUsesHeapWords) {
+  using namespace ptm;
+
+  const size_t n = 100000;
+  Event A = Event::Empty(n);
+  A.Insert(0);
+  A.Insert(n - 1);
+  A.Insert(4242);
+  EXPECT_EQ(A.GetSize(), 3u);
+  EXPECT_EQ((~A).GetSize(), n - 3);
+  A.Erase(4242);
+  EXPECT_FALSE(A.Contains(4242));
+  EXPECT_EQ(A.GetWords().size(), (n + 63) / 64);
+}
+
+TEST(SigmaAlgebraTest, MovedFromEventIsEmpty) {
+  using namespace ptm;
+
+  const size_t n = 1000;
+  Event a = Event::Full(n);
+  Event b = std::move(a);
+  EXPECT_EQ(b.GetSize(), n);
+  EXPECT_EQ(a.GetSize(), 0u); // NOLINT(bugprone-use-after-move)
+  EXPECT_EQ(a.GetSpaceSize(), 0u);
+  EXPECT_TRUE(a.GetWords().empty());
+
+  Event c = Event::Empty(n);
+  c = std::move(b);
+  EXPECT_EQ(c.GetSize(), n);
+  EXPECT_EQ(b.GetSize(), 0u); // NOLINT(bugprone-use-after-move)
+  EXPECT_FALSE(b.Contains(0));
+
+  // Из перемещённого события можно снова строить события
+  b = Event::Empty(n);
+  b.Insert(n - 1);
+  EXPECT_EQ((b | c).GetSize(), n);
+}
+
+TEST(SigmaAlgebraTest, EventsAndGeneratedAlgebraInArena) {
+  using namespace ptm;
+
+  const size_t n = 1000;
+  OutcomeSpace omega;
+  for (size_t i = 0; i < n; ++i) {
+    omega.AddOutcome(std::to_string(i));
+  }
+
+  // Арена без запасного ресурса: всё, что не поместилось в буфер, приводит к bad_alloc
+  std::vector<std::byte> buffer(1 << 16);
+  std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+  auto in_arena = [&](const Event& e) {
+    const auto* words = reinterpret_cast<const std::byte*>(e.GetWords().data());
+    return e.GetMemoryResource() == &arena && words >= buffer.data() && words < buffer.data() + buffer.size();
+  };
+
+  Event even = Event::Empty(n, &arena);
+  Event low = Event::Empty(n, &arena);
+  for (size_t i = 0; i < n; ++i) {
+    if (i % 2 == 0) {
+      even.Insert(i);
+    }
+    if (i < n / 2) {
+      low.Insert(i);
+    }
+  }
+  EXPECT_TRUE(in_arena(even));
+  EXPECT_EQ((even & low).GetSize(), n / 4);
+  EXPECT_FALSE(in_arena(Event::Full(n)));
+
+  // Составное присваивание и перемещение остаются в арене, копия и результат | - нет
+  Event both(even, &arena);
+  both |= low;
+  EXPECT_TRUE(in_arena(both));
+  Event moved = std::move(both);
+  EXPECT_TRUE(in_arena(moved));
+  EXPECT_FALSE(in_arena(even | low));
+  EXPECT_FALSE(in_arena(Event(even)));
+
+  SigmaAlgebra F = SigmaAlgebra::Generate(omega, {even, low}, &arena);
+  ASSERT_EQ(F.GetEventCount(), 16u);
+  for (const Event& e : F.GetEvents()) {
+    EXPECT_TRUE(in_arena(e));
+  }
+  EXPECT_TRUE(F.IsSigmaAlgebra());
+  EXPECT_EQ(F.EventAt(0b1111), Event::Full(n));
+}
+
+TEST(SigmaAlgebraTest, ArenaEventsLeaveScopeOnlyAsCopies) {
+  using namespace ptm;
+
+  const size_t n = 1000;
+  OutcomeSpace omega;
+  for (size_t i = 0; i < n; ++i) {
+    omega.AddOutcome(std::to_string(i));
+  }
+
+  std::vector<Event> kept;
+  {
+    // Арена, алгебра и все события из неё живут в одном блоке
+    std::pmr::monotonic_buffer_resource arena(size_t{1} << 16);
+    Event even = Event::Empty(n, &arena);
+    for (size_t i = 0; i < n; i += 2) {
+      even.Insert(i);
+    }
+    SigmaAlgebra F = SigmaAlgebra::Generate(omega, {even}, &arena);
+    for (const Event& e : F.GetEvents()) {
+      // События алгебры лежат в арене, их копии - в ресурсе по умолчанию
+      EXPECT_EQ(e.GetMemoryResource(), &arena);
+      kept.push_back(e);
+    }
+  }
+
+  ASSERT_EQ(kept.size(), 4u);
+  for (const Event& e : kept) {
+    EXPECT_EQ(e.GetMemoryResource(), std::pmr::get_default_resource());
+  }
+  EXPECT_TRUE(kept[0].IsEmpty());
+  EXPECT_EQ(kept[1].GetSize() + kept[2].GetSize(), n);
+  EXPECT_EQ(kept[1] | kept[2], Event::Full(n));
+  EXPECT_EQ(kept[3], Event::Full(n));
+}
+
+TEST(SigmaAlgebraTest, GeneratedEventsAreListedOnceAcrossThreads) {
+  using namespace ptm;
+
+  const size_t n = 600;
+  OutcomeSpace omega;
+  for (size_t i = 0; i < n; ++i) {
+    omega.AddOutcome(std::to_string(i));
+  }
+  std::vector<Event> generators;
+  for (size_t step = 2; step <= 6; ++step) {
+    Event e = Event::Empty(n);
+    for (size_t i = 0; i < n; i += step) {
+      e.Insert(i);
+    }
+    generators.push_back(e);
+  }
+  const SigmaAlgebra F = SigmaAlgebra::Generate(omega, generators);
+  const SigmaAlgebra copy = F;
+
+  // Первое обращение из нескольких потоков сразу: список строится один раз и общий для копий
+  constexpr size_t kThreads = 8;
+  std::vector<const std::vector<Event>*> lists(kThreads);
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] { lists[t] = &(t % 2 == 0 ? F : copy).GetEvents(); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (const std::vector<Event>* list : lists) {
+    EXPECT_EQ(list, lists.front());
+  }
+  ASSERT_EQ(lists.front()->size(), F.GetEventCount());
+  for (std::uint64_t i = 0; i < F.GetEventCount(); ++i) {
+    EXPECT_EQ((*lists.front())[i], F.EventAt(i));
+  }
+}
+
+TEST(SigmaAlgebraTest, BatchProbabilityMatchesSingleQueries) {
+  using namespace ptm;
+
+  const size_t n = 10000;
+  OutcomeSpace omega;
+  for (size_t i = 0; i < n; ++i) {
+    omega.AddOutcome(std::to_string(i));
+  }
+
+  ProbabilityMeasure P(omega);
+  for (size_t i = 0; i < n; ++i) {
+    P.SetAtomicProbability(i, 1.0 / static_cast<double>(n));
+  }
+  EXPECT_TRUE(P.IsValid(1e-9));
+
+  std::vector<Event> events;
+  for (size_t step = 1; step <= 7; ++step) {
+    Event e = Event::Empty(n);
+    for (size_t i = 0; i < n; i += step) {
+      e.Insert(i);
+    }
+    events.push_back(e);
+  }
+  events.push_back(Event::Full(n));
+  events.push_back(Event::Empty(n));
+
+  P.EnableCache(true);
+  auto batch = P.Probability(std::span<const Event>(events));
+  ASSERT_EQ(batch.size(), events.size());
+  for (size_t i = 0; i < events.size(); ++i) {
+    double expected = static_cast<double>(events[i].GetSize()) / static_cast<double>(n);
+    EXPECT_NEAR(batch[i], expected, 1e-12);
+    EXPECT_DOUBLE_EQ(P.Probability(events[i]), batch[i]);
+  }
+
+  // Изменение атомов сбрасывает кэш
+  P.SetAtomicProbability(0, 0.0);
+  EXPECT_NEAR(P.Probability(Event::Full(n)), 1.0 - 1.0 / static_cast<double>(n), 1e-12);
+  EXPECT_THROW((void) P.Probability(Event::Full(n + 1)), std::invalid_argument);
+}
+
+TEST(SigmaAlgebraTest, ProbabilityCacheOutlivesArenaOfQueriedEvents) {
+  using namespace ptm;
+
+  // 1000 исходов - 16 слов маски, больше встроенных в Event
+  const size_t n = 1000;
+  OutcomeSpace omega;
+  for (size_t i = 0; i < n; ++i) {
+    omega.AddOutcome(std::to_string(i));
+  }
+  ProbabilityMeasure P(omega);
+  for (size_t i = 0; i < n; ++i) {
+    P.SetAtomicProbability(i, 1.0 / static_cast<double>(n));
+  }
+  P.EnableCache(true);
+
+  auto first_outcomes = [n](size_t count, std::pmr::memory_resource* resource) {
+    Event e = Event::Empty(n, resource);
+    for (size_t i = 0; i < count; ++i) {
+      e.Insert(i);
+    }
+    return e;
+  };
+
+  {
+    std::pmr::monotonic_buffer_resource arena(size_t{1} << 16);
+    const Event half = first_outcomes(n / 2, &arena);
+    EXPECT_DOUBLE_EQ(P.Probability(half), 0.5);
+    const std::vector<Event> batch = {first_outcomes(n / 4, &arena), first_outcomes(n / 5, &arena)};
+    (void)P.Probability(std::span<const Event>(batch));
+  }
+
+  // Арена освобождена: поиск и перехэширование читают только ключи кэша
+  for (size_t count = 1; count <= 200; ++count) {
+    EXPECT_NEAR(P.Probability(first_outcomes(count, std::pmr::get_default_resource())),
+                static_cast<double>(count) / static_cast<double>(n), 1e-12);
+  }
+  EXPECT_DOUBLE_EQ(P.Probability(first_outcomes(n / 2, std::pmr::get_default_resource())), 0.5);
+  EXPECT_DOUBLE_EQ(P.Probability(first_outcomes(n / 4, std::pmr::get_default_resource())), 0.25);
+}
+
+TEST(SigmaAlgebraTest, GenerateFromGeneratorsBuildsAtoms) {
+  using namespace ptm;
+
+  OutcomeSpace omega;
+  for (int face = 1; face <= 6; ++face) {
+    omega.AddOutcome(std::to_string(face));
+  }
+
+  // "чётное" и "не больше 2" дают атомы {1}, {2}, {3,5}, {4,6}
+  Event even({false, true, false, true, false, true});
+  Event low({true, true, false, false, false, false});
+  SigmaAlgebra F = SigmaAlgebra::Generate(omega, {even, low});
+
+  auto atoms = F.GetAtoms();
+  ASSERT_EQ(atoms.size(), 4u);
+  EXPECT_EQ(atoms[0], Event({true, false, false, false, false, false}));
+  EXPECT_EQ(atoms[1], Event({false, true, false, false, false, false}));
+  EXPECT_EQ(atoms[2], Event({false, false, true, false, true, false}));
+  EXPECT_EQ(atoms[3], Event({false, false, false, true, false, true}));
+
+  EXPECT_EQ(F.GetEventCount(), 16u);
+  EXPECT_EQ(F.EventAt(0), Event::Empty(6));
+  EXPECT_EQ(F.EventAt(15), Event::Full(6));
+  EXPECT_EQ(F.EventAt(0b1010), even);
+  EXPECT_TRUE(F.IsSigmaAlgebra());
+
+  const auto& events = F.GetEvents();
+  ASSERT_EQ(events.size(), 16u);
+  for (std::uint64_t i = 0; i < events.size(); ++i) {
+    EXPECT_EQ(events[i], F.EventAt(i));
+  }
+
+  SigmaAlgebra explicit_algebra(omega, events);
+  EXPECT_TRUE(explicit_algebra.IsSigmaAlgebra());
+  EXPECT_EQ(explicit_algebra.GetAtoms(), atoms);
+}
+
+TEST(SigmaAlgebraTest, IsSigmaAlgebraRejectsNonClosedCollections) {
+  using namespace ptm;
+
+  OutcomeSpace omega;
+  omega.AddOutcome("a");
+  omega.AddOutcome("b");
+  omega.AddOutcome("c");
+
+  Event a({true, false, false});
+  Event bc({false, true, true});
+  Event b({false, true, false});
+
+  EXPECT_TRUE(SigmaAlgebra(omega, {Event::Empty(3), Event::Full(3)}).IsSigmaAlgebra());
+  EXPECT_TRUE(SigmaAlgebra(omega, {Event::Empty(3), a, bc, Event::Full(3)}).IsSigmaAlgebra());
+  // нет дополнения к {b}
+  EXPECT_FALSE(SigmaAlgebra(omega, {Event::Empty(3), a, b, Event::Full(3)}).IsSigmaAlgebra());
+  // нет пустого множества
+  EXPECT_FALSE(SigmaAlgebra(omega, {a, bc, Event::Full(3)}).IsSigmaAlgebra());
+  EXPECT_FALSE(SigmaAlgebra(omega, {}).IsSigmaAlgebra());
+}
+
+TEST(SigmaAlgebraTest, HashIndexedContainsAndParallelCheck) {
+  using namespace ptm;
+
+  // 2^12 событий над 1000 исходами: атомы - остатки по модулю 12
+  const size_t n = 1000;
+  OutcomeSpace omega;
+  for (size_t i = 0; i < n; ++i) {
+    omega.AddOutcome(std::to_string(i));
+  }
+
+  std::vector<Event> generators;
+  for (size_t r = 0; r < 12; ++r) {
+    Event g = Event::Empty(n);
+    for (size_t i = r; i < n; i += 12) {
+      g.Insert(i);
+    }
+    generators.push_back(g);
+  }
+  SigmaAlgebra generated = SigmaAlgebra::Generate(omega, generators);
+  ASSERT_EQ(generated.GetEventCount(), 4096u);
+
+  std::vector<Event> events = generated.GetEvents();
+  events.push_back(events[17]); // повтор не мешает
+  SigmaAlgebra F(omega, events);
+  EXPECT_TRUE(F.IsSigmaAlgebra());
+  EXPECT_TRUE(F.IsSigmaAlgebra(4));
+  EXPECT_TRUE(F.Contains(generators[3] | generators[7]));
+  EXPECT_TRUE(generated.Contains(generators[3] | generators[7]));
+
+  Event odd = Event::Empty(n);
+  odd.Insert(1);
+  EXPECT_FALSE(F.Contains(odd));
+  EXPECT_FALSE(generated.Contains(odd));
+
+  events.pop_back();
+  events.back() = odd;
+  EXPECT_FALSE(SigmaAlgebra(omega, events).IsSigmaAlgebra(4));
+}
+
+TEST(SigmaAlgebraTest, RandomVariableMomentsAndPushforward) {
+  using namespace ptm;
+
+  // X = остаток от деления грани кубика на 3
+  OutcomeSpace omega;
+  std::vector<double> values;
+  for (int face = 1; face <= 6; ++face) {
+    omega.AddOutcome(std::to_string(face));
+    values.push_back(face % 3);
+  }
+  ProbabilityMeasure P(omega);
+  for (size_t i = 0; i < 6; ++i) {
+    P.SetAtomicProbability(i, 1.0 / 6.0);
+  }
+
+  DiscreteRandomVariable X(omega, P, values);
+  auto moments = X.Moments();
+  EXPECT_NEAR(moments.mean, 1.0, 1e-12);
+  EXPECT_NEAR(moments.variance, 2.0 / 3.0, 1e-12);
+  EXPECT_NEAR(moments.third_central, 0.0, 1e-12);
+  EXPECT_NEAR(moments.fourth_central, 2.0 / 3.0, 1e-12);
+  EXPECT_NEAR(X.Expectation([](double x) { return x * x; }), 5.0 / 3.0, 1e-12);
+
+  // Ненормированная мера: E[X] и E[g(X)] делятся на одну и ту же массу
+  ProbabilityMeasure Q(omega);
+  for (size_t i = 0; i < 6; ++i) {
+    Q.SetAtomicProbability(i, 2.0);
+  }
+  DiscreteRandomVariable Y(omega, Q, values);
+  EXPECT_NEAR(Y.ExpectedValue(), 1.0, 1e-12);
+  EXPECT_NEAR(Y.Expectation([](double x) { return x; }), Y.ExpectedValue(), 1e-12);
+  EXPECT_NEAR(Y.Expectation([](double x) { return x * x; }), 5.0 / 3.0, 1e-12);
+
+  ProbabilityMeasure zero(omega);
+  DiscreteRandomVariable Z(omega, zero, values);
+  EXPECT_THROW((void)Z.ExpectedValue(), std::invalid_argument);
+  EXPECT_THROW((void)Z.Expectation([](double x) { return x; }), std::invalid_argument);
+
+  auto law = X.Pushforward();
+  EXPECT_EQ(law.GetValues(), (std::vector<double>{0.0, 1.0, 2.0}));
+  EXPECT_NEAR(law.Pdf(1.0), 1.0 / 3.0, 1e-12);
+  EXPECT_NEAR(law.Pdf(0.5), 0.0, 1e-12);
+  EXPECT_NEAR(law.Cdf(-1.0), 0.0, 1e-12);
+  EXPECT_NEAR(law.Cdf(1.5), 2.0 / 3.0, 1e-12);
+  EXPECT_NEAR(law.Cdf(2.0), 1.0, 1e-12);
+  EXPECT_NEAR(law.TheoreticalMean(), moments.mean, 1e-12);
+  EXPECT_NEAR(law.TheoreticalVariance(), moments.variance, 1e-12);
+
+  std::mt19937 rng(42);
+  std::vector<size_t> hits(3, 0);
+  const size_t draws = 60000;
+  for (size_t i = 0; i < draws; ++i) {
+    ++hits[static_cast<size_t>(law.Sample(rng))];
+  }
+  for (size_t count : hits) {
+    EXPECT_NEAR(static_cast<double>(count) / draws, 1.0 / 3.0, 0.01);
+  }
+}
+
+TEST(SigmaAlgebraTest, ProductSpaceWithoutMaterialization) {
+  using namespace ptm;
+
+  OutcomeSpace coin;
+  auto tails = coin.AddOutcome("T");
+  auto heads = coin.AddOutcome("H");
+  ProbabilityMeasure P(coin);
+  P.SetAtomicProbability(tails, 0.5);
+  P.SetAtomicProbability(heads, 0.5);
+
+  // 100 бросков: 2^100 исходов не перечисляются
+  auto flips = ProductProbabilitySpace::Power(coin, P, 100);
+  EXPECT_EQ(flips.GetFactorCount(), 100u);
+  EXPECT_THROW((void) flips.GetSize(), std::overflow_error);
+
+  Event heads_only({false, true});
+  std::vector<Event> first_three_heads(100, Event::Full(2));
+  for (size_t i = 0; i < 3; ++i) {
+    first_three_heads[i] = heads_only;
+  }
+  EXPECT_NEAR(flips.Probability(first_three_heads), 0.125, 1e-12);
+
+  std::vector<std::vector<double>> indicator(100, {0.0, 1.0});
+  EXPECT_NEAR(flips.ExpectationOfSum(indicator), 50.0, 1e-9);
+  EXPECT_NEAR(flips.VarianceOfSum(indicator), 25.0, 1e-9);
+  EXPECT_NEAR(flips.ExpectationOfProduct(indicator), std::pow(0.5, 100), 1e-40);
+
+  // Смешанная система счисления на маленьком произведении
+  OutcomeSpace die;
+  ProbabilityMeasure Q(die);
+  ProductProbabilitySpace small;
+  small.AddFactor(coin, P);
+  small.AddFactor(coin, P);
+  small.AddFactor(coin, P);
+  ASSERT_EQ(small.GetSize(), 8u);
+  std::vector<OutcomeSpace::OutcomeId> coords = {heads, tails, heads};
+  auto id = small.Encode(coords);
+  EXPECT_EQ(id, 5u);
+  EXPECT_EQ(small.Decode(id), coords);
+  EXPECT_EQ(small.GetName(id), "(H, T, H)");
+  EXPECT_NEAR(small.GetAtomicProbability(id), 0.125, 1e-12);
+
+  small.AddFactor(die, Q);
+  EXPECT_EQ(small.GetSize(), 0u);
+}
+
+TEST(SigmaAlgebraTest, OutcomeSpaceNameIndex) {
+  using namespace ptm;
+
+  std::vector<std::string> names;
+  for (size_t i = 0; i < 50000; ++i) {
+    names.push_back("outcome_" + std::to_string(i));
+  }
+
+  OutcomeSpace omega;
+  EXPECT_EQ(omega.AddOutcome("first"), 0u);
+  EXPECT_EQ(omega.AddOutcomes(names), 1u);
+  ASSERT_EQ(omega.GetSize(), names.size() + 1);
+
+  EXPECT_EQ(omega.Find("outcome_12345"), std::optional<OutcomeSpace::OutcomeId>(12346));
+  EXPECT_EQ(omega.GetName(12346), "outcome_12345");
+  EXPECT_EQ(omega.Find("first"), std::optional<OutcomeSpace::OutcomeId>(0));
+  EXPECT_FALSE(omega.Find("missing").has_value());
+
+  EXPECT_THROW(omega.AddOutcome("first"), std::invalid_argument);
+  std::vector<std::string> clash = {"new_a", "new_b", "outcome_7"};
+  EXPECT_THROW(omega.AddOutcomes(clash), std::invalid_argument);
+  EXPECT_EQ(omega.GetSize(), names.size() + 1);
+  EXPECT_FALSE(omega.Find("new_a").has_value());
+
+  OutcomeSpace copy = omega;
+  OutcomeSpace moved = std::move(omega);
+  EXPECT_EQ(copy.GetName(42), moved.GetName(42));
+  EXPECT_EQ(copy.Find("outcome_49999"), moved.Find("outcome_49999"));
+
+  // Перемещённое пространство пустое и снова принимает исходы
+  EXPECT_EQ(omega.GetSize(), 0u); // NOLINT(bugprone-use-after-move)
+  EXPECT_EQ(omega.AddOutcome("again"), 0u);
+  EXPECT_EQ(omega.GetName(0), "again");
+  OutcomeSpace reassigned;
+  reassigned = std::move(moved);
+  EXPECT_EQ(moved.AddOutcome("x"), 0u); // NOLINT(bugprone-use-after-move)
+  EXPECT_EQ(reassigned.GetName(42), copy.GetName(42));
+
+  // Пустое имя в пространстве без блоков: новом, перемещённом и его копии
+  OutcomeSpace fresh;
+  EXPECT_EQ(fresh.AddOutcome(""), 0u);
+  EXPECT_EQ(fresh.GetName(0), "");
+  EXPECT_EQ(fresh.Find(""), std::optional<OutcomeSpace::OutcomeId>(0));
+  EXPECT_THROW(fresh.AddOutcome(""), std::invalid_argument);
+  EXPECT_EQ(fresh.AddOutcome("a"), 1u);
+  OutcomeSpace fresh_copy = fresh;
+  EXPECT_EQ(fresh_copy.Find(""), std::optional<OutcomeSpace::OutcomeId>(0));
+  OutcomeSpace emptied = std::move(fresh);
+  EXPECT_EQ(emptied.GetSize(), 2u);
+  EXPECT_EQ(fresh.AddOutcome(""), 0u); // NOLINT(bugprone-use-after-move)
+}